@@ -13,6 +13,7 @@ typedef uint16_t _Py_CODEUNIT;
 #endif
 
 typedef struct _PyOpcache _PyOpcache;
+typedef struct _PyExcTable _PyExcTable;
 
 /* Bytecode object */
 struct PyCodeObject {
@@ -59,6 +60,14 @@ struct PyCodeObject {
     //  * n > 0 means there is cache in co_opcache[n-1].
     unsigned char *co_opcache_map;
     _PyOpcache *co_opcache;
+    // Try blocks active at each instruction, built when the code object is
+    // first executed (see _PyCode_InitExcTable()).
+    _PyExcTable *co_exctable;
+    // Copy of co_code using superinstructions, executed instead of co_code
+    // once the code object is hot (see _PyCode_Quicken()).
+    _Py_CODEUNIT *co_quickened;
+    // Machine code of the hot code object with -X jit (see _PyJIT_Compile()).
+    struct _PyJITCode *co_jit;
     int co_opcache_flag;  // used to determine when create a cache.
     unsigned char co_opcache_size;  // length of co_opcache.
 };
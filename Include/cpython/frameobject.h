@@ -45,6 +45,7 @@ struct _frame {
     int f_lineno;               /* Current line number. Only valid if non-zero */
     int f_iblock;               /* index in f_blockstack */
     PyFrameState f_state;       /* What state the frame is in */
+    char f_stacked;             /* Allocated from the thread's frame stack? */
     PyTryBlock f_blockstack[CO_MAXBLOCKS]; /* for try and loop blocks */
     PyObject *f_localsplus[1];  /* locals+stack, dynamically sized */
 };
@@ -73,6 +74,8 @@ PyAPI_FUNC(PyFrameObject *) PyFrame_New(PyThreadState *, PyCodeObject *,
 /* only internal use */
 PyFrameObject*
 _PyFrame_New_NoTrack(PyThreadState *, PyFrameConstructor *, PyObject *);
+PyFrameObject*
+_PyFrame_NewStacked_NoTrack(PyThreadState *, PyFrameConstructor *, PyObject *);
 
 
 /* The rest of the interface is specific for frame objects */
@@ -82,6 +85,10 @@ _PyFrame_New_NoTrack(PyThreadState *, PyFrameConstructor *, PyObject *);
 PyAPI_FUNC(void) PyFrame_BlockSetup(PyFrameObject *, int, int, int);
 PyAPI_FUNC(PyTryBlock *) PyFrame_BlockPop(PyFrameObject *);
 
+/* only internal use */
+void _PyFrame_MaterializeBlocks(PyFrameObject *, int);
+void _PyFrame_CompactBlocks(PyFrameObject *);
+
 /* Conversions between "fast locals" and locals in dictionary */
 
 PyAPI_FUNC(void) PyFrame_LocalsToFast(PyFrameObject *, int);
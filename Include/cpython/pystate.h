@@ -147,6 +147,11 @@ struct _ts {
 
     CFrame root_cframe;
 
+    /* Memory the frames of Python-to-Python calls are carved out of,
+       see Objects/frameobject.c */
+    struct _PyFrameStackChunk *framestack_chunk;
+    struct _PyFrameStackSlot *framestack_top;
+
     /* XXX signal handlers should also be here */
 
 };
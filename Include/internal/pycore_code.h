@@ -16,16 +16,79 @@ typedef struct {
     unsigned int tp_version_tag;
 } _PyOpCodeOpt_LoadAttr;
 
+/* Operand types an adaptive opcode has been specialized for.  The kind is
+   chosen the first time the instruction runs with an opcache and is guarded
+   on every later run; the entry is dropped after too many guard failures. */
+enum _PyOpcache_Kind {
+    _PyOpcache_GENERIC = 0,
+    _PyOpcache_INT_INT,         /* BINARY_ADD, BINARY_SUBTRACT, COMPARE_OP */
+    _PyOpcache_FLOAT_FLOAT,     /* BINARY_ADD, BINARY_SUBTRACT, COMPARE_OP */
+    _PyOpcache_STR_STR,         /* COMPARE_OP */
+    _PyOpcache_LIST_INT,        /* BINARY_SUBSCR */
+    _PyOpcache_TUPLE_INT,       /* BINARY_SUBSCR */
+    _PyOpcache_DICT_STR,        /* BINARY_SUBSCR */
+    _PyOpcache_BUILTIN_O,       /* CALL_FUNCTION, CALL_METHOD */
+    _PyOpcache_BUILTIN_FAST,    /* CALL_FUNCTION, CALL_METHOD */
+    _PyOpcache_METHOD_O,        /* CALL_METHOD */
+    _PyOpcache_METHOD_FAST,     /* CALL_METHOD */
+};
+
+typedef struct {
+    int kind;  /* enum _PyOpcache_Kind */
+} _PyOpcache_Specialized;
+
 struct _PyOpcache {
     union {
         _PyOpcache_LoadGlobal lg;
-        _PyOpCodeOpt_LoadAttr la;
+        _PyOpCodeOpt_LoadAttr la;  /* LOAD_ATTR and STORE_ATTR */
+        _PyOpcache_Specialized sp;
     } u;
     char optimized;
 };
 
+/* Exception table.
+
+   Which try blocks are active at an instruction is a static property of the
+   bytecode, so SETUP_FINALLY, SETUP_WITH, SETUP_ASYNC_WITH and POP_BLOCK do
+   not touch f_blockstack when the code object has an exception table.  The
+   eval loop only looks the blocks up when an exception is raised.  The
+   EXCEPT_HANDLER blocks pushed when a handler is entered carry run time
+   state and are still kept on f_blockstack. */
+typedef struct {
+    int eb_type;      /* SETUP_FINALLY or EXCEPT_HANDLER */
+    int eb_handler;   /* handler offset of a SETUP_FINALLY block */
+    int eb_level;     /* value stack level to pop to */
+    int eb_parent;    /* index of the enclosing block, or -1 */
+} _PyExcTableBlock;
+
+typedef struct {
+    int er_start;     /* first instruction of the range */
+    int er_block;     /* innermost block of the range, or -1 */
+} _PyExcTableRange;
+
+struct _PyExcTable {
+    int et_nblocks;   /* 0 if try blocks are pushed on f_blockstack */
+    int et_nranges;
+    _PyExcTableBlock *et_blocks;
+    _PyExcTableRange *et_ranges;  /* sorted by er_start */
+};
+
 /* Private API */
 int _PyCode_InitOpcache(PyCodeObject *co);
+int _PyCode_InitExcTable(PyCodeObject *co);
+int _PyCode_Quicken(PyCodeObject *co);
+
+/* Return the index of the innermost block active at instruction 'lasti',
+   or -1 if there is none. */
+int _PyExcTable_Lookup(const _PyExcTable *table, int lasti);
+
+/* True if the try blocks of the code object are described by its exception
+   table rather than pushed on the frame's block stack. */
+static inline int
+_PyCode_HasExcTable(PyCodeObject *co)
+{
+    return co->co_exctable != NULL && co->co_exctable->et_nblocks > 0;
+}
 
 
 #ifdef __cplusplus
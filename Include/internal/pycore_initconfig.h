@@ -166,6 +166,7 @@ PyAPI_FUNC(PyObject*) _PyConfig_AsDict(const PyConfig *config);
 PyAPI_FUNC(int) _PyConfig_FromDict(PyConfig *config, PyObject *dict);
 
 extern int _Py_global_config_int_max_str_digits;
+extern int _Py_global_config_jit;
 
 
 /* --- Function used for testing ---------------------------------- */
@@ -0,0 +1,134 @@
+#ifndef Py_INTERNAL_JIT_H
+#define Py_INTERNAL_JIT_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+#include <stddef.h>               // offsetof()
+#include "longintrepr.h"          // PyLongObject
+#include "pycore_code.h"          // _PyOpCodeOpt_LoadAttr
+#include "pycore_interp.h"        // PyInterpreterState.ceval
+
+/* Copy-and-patch JIT.
+
+   A hot code object is translated by copying, for each instruction, a
+   machine code template ("stencil") compiled ahead of time from
+   Tools/jit/template.c, and patching its holes with the oparg, constants,
+   jump targets and addresses of C functions.  Stencils chain into each
+   other with tail calls; the code returns to _PyEval_EvalFrameDefault()
+   when the function returns or raises, and "deoptimizes" to the
+   interpreter at instructions it has no stencil for. */
+
+/* Values of _Py_global_config_jit */
+#define _PyJIT_OFF 0
+#define _PyJIT_HOT 1      /* -X jit: compile code objects once they are hot */
+#define _PyJIT_ALWAYS 2   /* -X jit=always: compile them on their first run */
+
+/* How the machine code gave control back to the interpreter */
+enum _PyJIT_Status {
+    _PyJIT_RETURN,  /* the return value is on top of the stack */
+    _PyJIT_ERROR,   /* an exception was raised by instruction f_lasti */
+    _PyJIT_DEOPT,   /* continue by interpreting instruction f_lasti */
+    _PyJIT_TRACE,   /* tracing was turned on by instruction f_lasti,
+                       continue after it */
+};
+
+typedef struct {
+    PyObject **stack_pointer;
+    int status;  /* enum _PyJIT_Status */
+} _PyJITResult;
+
+typedef _PyJITResult (*_PyJITFunction)(PyFrameObject *f,
+                                       PyObject **stack_pointer,
+                                       PyThreadState *tstate);
+
+/* Cache of a LOAD_GLOBAL instruction, see _PyOpcache_LoadGlobal */
+typedef struct {
+    PyObject *name;
+    PyObject *ptr;  /* borrowed reference */
+    uint64_t globals_ver;
+    uint64_t builtins_ver;
+} _PyJITLoadGlobal;
+
+/* Cache of a LOAD_ATTR instruction, filled like the opcache entry */
+typedef struct {
+    PyObject *name;
+    _PyOpCodeOpt_LoadAttr la;
+} _PyJITLoadAttr;
+
+typedef union {
+    _PyJITLoadGlobal lg;
+    _PyJITLoadAttr la;
+} _PyJITCache;
+
+struct _PyJITCode {
+    char *jc_memory;              /* executable, jc_size bytes */
+    size_t jc_size;
+    _PyJITCache *jc_caches;       /* of the LOAD_GLOBAL and LOAD_ATTR
+                                     instructions */
+    _PyJITFunction jc_entries[1]; /* machine code of every instruction */
+};
+
+/* Struct members the stencils access directly.  The stencils record the
+   values they were compiled with, and the JIT stays disabled if they do
+   not match the running interpreter. */
+#ifdef Py_REF_DEBUG
+#  define _PyJIT_REF_DEBUG 1
+#else
+#  define _PyJIT_REF_DEBUG 0
+#endif
+#define _PyJIT_LAYOUT \
+    _PyJIT_REF_DEBUG, \
+    sizeof(PyObject), \
+    offsetof(PyObject, ob_refcnt), \
+    offsetof(PyObject, ob_type), \
+    offsetof(PyVarObject, ob_size), \
+    offsetof(PyTypeObject, tp_richcompare), \
+    offsetof(PyLongObject, ob_digit), \
+    offsetof(PyFloatObject, ob_fval), \
+    offsetof(PyListObject, ob_item), \
+    offsetof(PyTupleObject, ob_item), \
+    offsetof(PyFrameObject, f_globals), \
+    offsetof(PyFrameObject, f_builtins), \
+    offsetof(PyFrameObject, f_lasti), \
+    offsetof(PyFrameObject, f_localsplus), \
+    offsetof(PyThreadState, interp), \
+    offsetof(PyThreadState, cframe), \
+    offsetof(CFrame, use_tracing), \
+    offsetof(PyInterpreterState, ceval.eval_breaker), \
+    offsetof(PyDictObject, ma_version_tag)
+
+/* Private API */
+
+/* Translate a code object to machine code if -X jit is enabled and the
+   platform is supported; leave co->co_jit NULL otherwise. */
+int _PyJIT_Compile(PyCodeObject *co);
+void _PyJIT_Free(struct _PyJITCode *jit);
+/* Run the machine code of an instruction */
+_PyJITResult _PyJIT_Enter(PyFrameObject *f, PyObject **stack_pointer,
+                          PyThreadState *tstate, _PyJITFunction entry);
+
+/* Helpers called by the stencils */
+_PyJITResult _PyJIT_DecrefAndGoto(PyObject *op, PyFrameObject *f,
+                                  PyObject **stack_pointer,
+                                  PyThreadState *tstate, _PyJITFunction next);
+PyObject *_PyJIT_LoadGlobal(PyFrameObject *f, _PyJITLoadGlobal *cache);
+PyObject *_PyJIT_LoadAttr(PyObject *owner, _PyJITLoadAttr *cache);
+PyObject *_PyJIT_CallFunction(PyThreadState *tstate, PyObject **stack_pointer,
+                              Py_ssize_t oparg, PyObject *kwnames);
+PyObject *_PyJIT_BuildTuple(PyObject **stack_pointer, Py_ssize_t oparg);
+PyObject *_PyJIT_BuildList(PyObject **stack_pointer, Py_ssize_t oparg);
+int _PyJIT_UnpackSequence(PyObject *seq, Py_ssize_t oparg,
+                          PyObject **stack_pointer);
+PyObject *_PyJIT_IterNext(PyObject *iter);
+PyObject *_PyJIT_UnicodeConcatenate(PyFrameObject *f, PyObject *v,
+                                    PyObject *w, int store_fast);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_JIT_H */
@@ -69,6 +69,11 @@ static inline PyObject* _PyLong_GetZero(void)
 static inline PyObject* _PyLong_GetOne(void)
 { return __PyLong_GetSmallInt_internal(1); }
 
+// Add or subtract two exact ints, skipping the binary operator dispatch.
+// Used by the specialized BINARY_ADD and BINARY_SUBTRACT in ceval.c.
+extern PyObject *_PyLong_Add(PyLongObject *left, PyLongObject *right);
+extern PyObject *_PyLong_Subtract(PyLongObject *left, PyLongObject *right);
+
 #ifdef __cplusplus
 }
 #endif
@@ -82,6 +82,7 @@ extern PyStatus _PyAtExit_Init(PyInterpreterState *interp);
 /* Various internal finalizers */
 
 extern void _PyFrame_Fini(PyInterpreterState *interp);
+extern void _PyFrame_ClearStack(PyThreadState *tstate);
 extern void _PyDict_Fini(PyInterpreterState *interp);
 extern void _PyTuple_Fini(PyInterpreterState *interp);
 extern void _PyList_Fini(PyInterpreterState *interp);
@@ -135,6 +135,16 @@ extern "C" {
 #define SET_UPDATE              163
 #define DICT_MERGE              164
 #define DICT_UPDATE             165
+#define LOAD_FAST_AND_CLEAR     166
+
+    /* Superinstructions, see Lib/opcode.py */
+#define LOAD_FAST__LOAD_FAST    120
+#define STORE_FAST__LOAD_FAST   123
+#define LOAD_FAST__LOAD_CONST   127
+#define LOAD_FAST__LOAD_ATTR    128
+#define LOAD_CONST__LOAD_FAST   134
+#define LOAD_CONST__RETURN_VALUE 139
+#define STORE_FAST__STORE_FAST  140
 #ifdef NEED_OPCODE_JUMP_TABLES
 static uint32_t _PyOpcode_RelativeJump[8] = {
     0U,
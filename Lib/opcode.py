@@ -212,5 +212,24 @@ def jabs_op(name, op):
 def_op('SET_UPDATE', 163)
 def_op('DICT_MERGE', 164)
 def_op('DICT_UPDATE', 165)
+def_op('LOAD_FAST_AND_CLEAR', 166)  # Local variable number
+haslocal.append(166)
 
 del def_op, name_op, jrel_op, jabs_op
+
+# Superinstructions are never emitted by the compiler.  The interpreter
+# rewrites its private copy of a hot code object's bytecode to use them (see
+# _PyCode_Quicken()): the first instruction of a pair gets the fused opcode,
+# the second one is kept.  The pairs are the most frequent ones reported by
+# Tools/scripts/analyze_dxp.py for a -DDYNAMIC_EXECUTION_PROFILE -DDXPAIRS
+# build running the test suite.  Their numbers are unused opcodes, assigned
+# in order by Tools/scripts/generate_opcode_h.py.
+_superinstructions = [
+    "LOAD_FAST__LOAD_FAST",
+    "STORE_FAST__LOAD_FAST",
+    "LOAD_FAST__LOAD_CONST",
+    "LOAD_FAST__LOAD_ATTR",
+    "LOAD_CONST__LOAD_FAST",
+    "LOAD_CONST__RETURN_VALUE",
+    "STORE_FAST__STORE_FAST",
+]
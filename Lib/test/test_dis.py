@@ -148,21 +148,30 @@ def bug1333982(x=[]):
 
 dis_bug1333982 = """\
 %3d           0 LOAD_ASSERTION_ERROR
-              2 LOAD_CONST               2 (<code object <listcomp> at 0x..., file "%s", line %d>)
-              4 LOAD_CONST               3 ('bug1333982.<locals>.<listcomp>')
-              6 MAKE_FUNCTION            0
-              8 LOAD_FAST                0 (x)
-             10 GET_ITER
-             12 CALL_FUNCTION            1
-
-%3d          14 LOAD_CONST               4 (1)
-
-%3d          16 BINARY_ADD
-             18 CALL_FUNCTION            1
-             20 RAISE_VARARGS            1
+              2 BUILD_LIST               0
+              4 LOAD_FAST                0 (x)
+              6 GET_ITER
+              8 LOAD_FAST_AND_CLEAR      1 (s)
+             10 STORE_FAST               2 (.s)
+             12 SETUP_FINALLY           12 (to 38)
+        >>   14 FOR_ITER                 4 (to 24)
+             16 STORE_FAST               1 (s)
+             18 LOAD_FAST                1 (s)
+             20 LIST_APPEND              2
+             22 JUMP_ABSOLUTE            7 (to 14)
+        >>   24 POP_BLOCK
+             26 LOAD_FAST_AND_CLEAR      2 (.s)
+             28 STORE_FAST               1 (s)
+
+%3d          30 LOAD_CONST               2 (1)
+
+%3d          32 BINARY_ADD
+             34 CALL_FUNCTION            1
+             36 RAISE_VARARGS            1
+        >>   38 LOAD_FAST_AND_CLEAR      2 (.s)
+             40 STORE_FAST               1 (s)
+             42 RERAISE                  0
 """ % (bug1333982.__code__.co_firstlineno + 1,
-       __file__,
-       bug1333982.__code__.co_firstlineno + 1,
        bug1333982.__code__.co_firstlineno + 2,
        bug1333982.__code__.co_firstlineno + 1)
 
@@ -427,7 +436,7 @@ async def _co(x):
 def _h(y):
     def foo(x):
         '''funcdoc'''
-        return [x + z for z in y]
+        return list(x + z for z in y)
     return foo
 
 dis_nested_0 = """\
@@ -448,15 +457,17 @@ def foo(x):
 
 dis_nested_1 = """%s
 Disassembly of <code object foo at 0x..., file "%s", line %d>:
-%3d           0 LOAD_CLOSURE             0 (x)
-              2 BUILD_TUPLE              1
-              4 LOAD_CONST               1 (<code object <listcomp> at 0x..., file "%s", line %d>)
-              6 LOAD_CONST               2 ('_h.<locals>.foo.<locals>.<listcomp>')
-              8 MAKE_FUNCTION            8 (closure)
-             10 LOAD_DEREF               1 (y)
-             12 GET_ITER
-             14 CALL_FUNCTION            1
-             16 RETURN_VALUE
+%3d           0 LOAD_GLOBAL              0 (list)
+              2 LOAD_CLOSURE             0 (x)
+              4 BUILD_TUPLE              1
+              6 LOAD_CONST               1 (<code object <genexpr> at 0x..., file "%s", line %d>)
+              8 LOAD_CONST               2 ('_h.<locals>.foo.<locals>.<genexpr>')
+             10 MAKE_FUNCTION            8 (closure)
+             12 LOAD_DEREF               1 (y)
+             14 GET_ITER
+             16 CALL_FUNCTION            1
+             18 CALL_FUNCTION            1
+             20 RETURN_VALUE
 """ % (dis_nested_0,
        __file__,
        _h.__code__.co_firstlineno + 1,
@@ -466,17 +477,20 @@ def foo(x):
 )
 
 dis_nested_2 = """%s
-Disassembly of <code object <listcomp> at 0x..., file "%s", line %d>:
-%3d           0 BUILD_LIST               0
-              2 LOAD_FAST                0 (.0)
-        >>    4 FOR_ITER                 6 (to 18)
+Disassembly of <code object <genexpr> at 0x..., file "%s", line %d>:
+              0 GEN_START                0
+
+%3d           2 LOAD_FAST                0 (.0)
+        >>    4 FOR_ITER                 7 (to 20)
               6 STORE_FAST               1 (z)
               8 LOAD_DEREF               0 (x)
              10 LOAD_FAST                1 (z)
              12 BINARY_ADD
-             14 LIST_APPEND              2
-             16 JUMP_ABSOLUTE            2 (to 4)
-        >>   18 RETURN_VALUE
+             14 YIELD_VALUE
+             16 POP_TOP
+             18 JUMP_ABSOLUTE            2 (to 4)
+        >>   20 LOAD_CONST               0 (None)
+             22 RETURN_VALUE
 """ % (dis_nested_1,
        __file__,
        _h.__code__.co_firstlineno + 3,
@@ -2586,5 +2586,111 @@ def after_with():
                 1/0
         self.lineno_after_raise(after_with, 1, 1)
 
+
+class ExceptionTableTests(unittest.TestCase):
+    # Try blocks are found through the code object's exception table rather
+    # than pushed on the frame as they are entered.
+
+    def test_nested_blocks(self):
+        events = []
+        class CM:
+            def __init__(self, name):
+                self.name = name
+            def __enter__(self):
+                events.append(("enter", self.name))
+            def __exit__(self, exc_type, exc, tb):
+                events.append(("exit", self.name, exc_type))
+
+        def f(n):
+            for i in range(n):
+                try:
+                    with CM("a"):
+                        try:
+                            with CM("b"):
+                                if i == 1:
+                                    raise KeyError(i)
+                                if i == 2:
+                                    raise ValueError(i)
+                        except KeyError:
+                            events.append(("except", i))
+                        finally:
+                            events.append(("finally", i))
+                except ValueError:
+                    events.append(("outer", i))
+        f(3)
+        self.assertEqual(events, [
+            ("enter", "a"), ("enter", "b"), ("exit", "b", None),
+            ("finally", 0), ("exit", "a", None),
+            ("enter", "a"), ("enter", "b"), ("exit", "b", KeyError),
+            ("except", 1), ("finally", 1), ("exit", "a", None),
+            ("enter", "a"), ("enter", "b"), ("exit", "b", ValueError),
+            ("finally", 2), ("exit", "a", ValueError), ("outer", 2),
+        ])
+
+    def test_value_stack_unwound(self):
+        def fail():
+            raise ValueError
+        def f():
+            result = []
+            for x in [1, 2]:
+                try:
+                    result.append((x, [x, x], fail()))
+                except ValueError:
+                    result.append(x)
+            return result
+        self.assertEqual(f(), [1, 2])
+
+    def test_raise_in_handler(self):
+        def f():
+            try:
+                try:
+                    raise KeyError
+                except KeyError:
+                    try:
+                        raise ValueError
+                    except ValueError:
+                        self.assertIsInstance(sys.exc_info()[1], ValueError)
+                    self.assertIsInstance(sys.exc_info()[1], KeyError)
+                    raise TypeError
+            except TypeError as e:
+                self.assertIsInstance(e.__context__, KeyError)
+                return "caught"
+        self.assertEqual(f(), "caught")
+        self.assertEqual(sys.exc_info(), (None, None, None))
+
+    def test_generator_resumed_in_block(self):
+        def gen():
+            try:
+                yield 1
+                try:
+                    yield 2
+                except KeyError:
+                    yield "inner"
+                yield 3
+            except ValueError:
+                yield "outer"
+        g = gen()
+        self.assertEqual(next(g), 1)
+        self.assertEqual(next(g), 2)
+        self.assertEqual(g.throw(KeyError), "inner")
+        self.assertEqual(g.throw(ValueError), "outer")
+
+        g = gen()
+        self.assertEqual(next(g), 1)
+        self.assertEqual(g.throw(ValueError), "outer")
+
+    def test_reraise_traceback(self):
+        def f():
+            try:
+                1/0
+            finally:
+                pass
+        try:
+            f()
+        except ZeroDivisionError as e:
+            tb = e.__traceback__.tb_next
+        self.assertEqual(tb.tb_lineno, f.__code__.co_firstlineno + 2)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -1,10 +1,12 @@
 import re
 import sys
+import threading
 import types
 import unittest
 import weakref
 
 from test import support
+from test.support import threading_helper
 
 
 class ClearTest(unittest.TestCase):
@@ -223,5 +225,67 @@ def inner():
                          % (file_repr, offset + 5))
 
 
+class FrameStackTest(unittest.TestCase):
+    # Frames of recursive calls are carved out of a per-thread stack;
+    # frames that outlive their call must stay valid.
+
+    def test_escaping_frames(self):
+        frames = []
+        def f(n):
+            x = n * 2
+            frames.append(sys._getframe())
+            if n:
+                f(n - 1)
+            return x
+        for _ in range(3):
+            f(300)
+        self.assertEqual(len(frames), 903)
+        for i, frame in enumerate(frames[:301]):
+            self.assertEqual(frame.f_locals['n'], 300 - i)
+            self.assertEqual(frame.f_locals['x'], (300 - i) * 2)
+        # Frames below a kept one are released out of order
+        del frames[::2]
+        self.assertEqual(frames[0].f_locals['n'], 299)
+        frames.clear()
+
+    def test_traceback_frames(self):
+        def f(n):
+            if n == 0:
+                raise ValueError(n)
+            return f(n - 1)
+        try:
+            f(200)
+        except ValueError as exc:
+            tb = exc.__traceback__
+        depths = []
+        while tb is not None:
+            if tb.tb_frame.f_code is f.__code__:
+                depths.append(tb.tb_frame.f_locals['n'])
+            tb = tb.tb_next
+        self.assertEqual(depths, list(range(200, -1, -1)))
+
+    def test_deep_recursion_reuses_memory(self):
+        def f(n):
+            return f(n - 1) + 1 if n else 0
+        for n in (10, 500, 10, 500, 1):
+            self.assertEqual(f(n), n)
+
+    @threading_helper.reap_threads
+    def test_frames_outlive_thread(self):
+        frames = []
+        def f(n):
+            frames.append(sys._getframe())
+            if n:
+                f(n - 1)
+        for _ in range(3):
+            t = threading.Thread(target=f, args=(50,))
+            t.start()
+            t.join()
+        self.assertEqual(len(frames), 153)
+        self.assertEqual([fr.f_locals['n'] for fr in frames[-51:]],
+                         list(range(50, -1, -1)))
+        frames.clear()
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -139,6 +139,92 @@
     >>> test_func()
     [2, 2, 2, 2, 2]
 
+########### Comprehensions compiled inline in functions ############
+
+The iteration variable does not leak into the function
+
+    >>> def test_func():
+    ...     x = 'outer'
+    ...     y = [x for x in range(3)]
+    ...     return x, y
+    >>> test_func()
+    ('outer', [0, 1, 2])
+
+    >>> def test_func():
+    ...     y = [x for x in range(3)]
+    ...     return x
+    >>> test_func()
+    Traceback (most recent call last):
+      ...
+    NameError: name 'x' is not defined
+
+    >>> def test_func(x):
+    ...     y = [x * 2 for x in x]
+    ...     return x, y
+    >>> test_func([1, 2])
+    ([1, 2], [2, 4])
+
+The variable is restored when the comprehension raises
+
+    >>> def test_func():
+    ...     x = 'outer'
+    ...     try:
+    ...         [1 // x for x in [1, 0]]
+    ...     except ZeroDivisionError:
+    ...         return x
+    >>> test_func()
+    'outer'
+
+    >>> def test_func():
+    ...     try:
+    ...         [1 // x for x in [1, 0]]
+    ...     except ZeroDivisionError:
+    ...         pass
+    ...     return 'x' in locals()
+    >>> test_func()
+    False
+
+Names assigned with := are bound in the function
+
+    >>> def test_func():
+    ...     y = [last := x for x in range(3)]
+    ...     return last, y
+    >>> test_func()
+    (2, [0, 1, 2])
+
+Variables captured by a closure in the comprehension keep their own scope
+
+    >>> def test_func():
+    ...     x = 'outer'
+    ...     items = [lambda: x for x in range(3)]
+    ...     return x, [f() for f in items]
+    >>> test_func()
+    ('outer', [2, 2, 2])
+
+    >>> def test_func():
+    ...     x = 'outer'
+    ...     def inner():
+    ...         return x
+    ...     y = [x for x in range(3)]
+    ...     return inner(), y
+    >>> test_func()
+    ('outer', [0, 1, 2])
+
+Nested comprehensions and globals
+
+    >>> def test_func():
+    ...     i = j = None
+    ...     y = [[i * j for j in range(3)] for i in range(3)]
+    ...     return i, j, y
+    >>> test_func()
+    (None, None, [[0, 0, 0], [0, 1, 2], [0, 2, 4]])
+
+    >>> g = 10
+    >>> def test_func():
+    ...     return [g + x for x in range(3)], {x: g for x in 'ab'}, {g for x in 'ab'}
+    >>> test_func()
+    ([10, 11, 12], {'a': 10, 'b': 10}, {10})
+
 """
 
 
@@ -1,3 +1,4 @@
+import sys
 import unittest
 
 class TestLoadAttrCache(unittest.TestCase):
@@ -21,3 +22,358 @@ def f(o):
         Descriptor.__set__ = lambda *args: None
 
         self.assertEqual(f(o), 2)
+
+
+# Code objects get an opcode cache after they have run 1024 times.  The tests
+# below warm a function up with one kind of operands and then check that other
+# kinds still behave exactly like the generic opcode.
+WARMUP = 1100
+
+
+def warm_up(func, *args):
+    for _ in range(WARMUP):
+        func(*args)
+
+
+def last_lineno(exc):
+    tb = exc.__traceback__
+    while tb.tb_next is not None:
+        tb = tb.tb_next
+    return tb.tb_lineno
+
+
+class BinaryOpTests(unittest.TestCase):
+
+    def test_add_int(self):
+        def f(a, b):
+            return a + b
+        warm_up(f, 1, 2)
+        self.assertEqual(f(3, 4), 7)
+        self.assertEqual(f(-3, 2), -1)
+        self.assertEqual(f(2**40, 2**40), 2**41)
+        self.assertEqual(f(2**100, -2**100), 0)
+        self.assertIs(type(f(True, True)), int)
+        self.assertEqual(f(1.5, 2), 3.5)
+        self.assertEqual(f("a", "b"), "ab")
+        self.assertEqual(f([1], [2]), [1, 2])
+
+    def test_add_float(self):
+        def f(a, b):
+            return a + b
+        warm_up(f, 1.0, 2.0)
+        self.assertEqual(f(0.5, 0.25), 0.75)
+        self.assertEqual(f(1e308, 1e308), float('inf'))
+        self.assertEqual(f(1.0, 2), 3.0)
+
+    def test_subtract(self):
+        def f(a, b):
+            return a - b
+        warm_up(f, 5, 2)
+        self.assertEqual(f(2, 5), -3)
+        self.assertEqual(f(-2**70, 2**70), -2**71)
+        self.assertEqual(f(2.5, 1.0), 1.5)
+        self.assertEqual(f({1, 2}, {1}), {2})
+        with self.assertRaises(TypeError):
+            f("a", "b")
+
+    def test_int_subclass(self):
+        class MyInt(int):
+            def __add__(self, other):
+                return "custom"
+        def f(a, b):
+            return a + b
+        warm_up(f, 1, 2)
+        self.assertEqual(f(MyInt(1), 2), "custom")
+        self.assertEqual(f(1, 2), 3)
+
+
+class CompareOpTests(unittest.TestCase):
+
+    def test_int(self):
+        def f(a, b):
+            return a < b, a <= b, a == b, a != b, a > b, a >= b
+        warm_up(f, 1, 2)
+        self.assertEqual(f(3, 3), (False, True, True, False, False, True))
+        self.assertEqual(f(-2**80, 2**80), (True, True, False, True, False, False))
+        self.assertEqual(f(1, 1.5), (True, True, False, True, False, False))
+
+    def test_float(self):
+        def f(a, b):
+            return a < b, a == b, a != b
+        warm_up(f, 1.0, 2.0)
+        nan = float('nan')
+        self.assertEqual(f(nan, nan), (False, False, True))
+        self.assertEqual(f(-0.0, 0.0), (False, True, False))
+
+    def test_str(self):
+        def f(a, b):
+            return a == b, a < b
+        warm_up(f, "abc", "abd")
+        self.assertEqual(f("x", "x"), (True, False))
+        self.assertEqual(f("€", "a"), (False, False))
+        with self.assertRaises(TypeError):
+            f("a", 1)
+
+
+class BinarySubscrTests(unittest.TestCase):
+
+    def test_list_tuple(self):
+        def f(seq, i):
+            return seq[i]
+        warm_up(f, [1, 2, 3], 0)
+        self.assertEqual(f([1, 2, 3], -1), 3)
+        self.assertEqual(f((1, 2, 3), 1), 2)
+        self.assertEqual(f([1, 2, 3], slice(1, None)), [2, 3])
+        self.assertEqual(f("abc", 1), "b")
+        with self.assertRaises(IndexError):
+            f([1, 2, 3], 3)
+        with self.assertRaises(IndexError):
+            f([1, 2, 3], -4)
+        with self.assertRaises(IndexError):
+            f([1, 2, 3], 2**100)
+
+    def test_dict(self):
+        def f(d, k):
+            return d[k]
+        warm_up(f, {"a": 1}, "a")
+        self.assertEqual(f({"b": 2}, "b"), 2)
+        with self.assertRaises(KeyError) as cm:
+            f({"b": 2}, "c")
+        self.assertEqual(cm.exception.args, ("c",))
+
+        class Missing(dict):
+            def __missing__(self, key):
+                return key * 2
+        self.assertEqual(f(Missing(), "x"), "xx")
+        self.assertEqual(f({1: 2}, 1), 2)
+
+
+class StoreAttrTests(unittest.TestCase):
+
+    def test_instance_dict(self):
+        class C:
+            pass
+        def f(obj, value):
+            obj.x = value
+        objs = [C() for _ in range(WARMUP)]
+        for i, obj in enumerate(objs):
+            f(obj, i)
+        self.assertEqual([obj.x for obj in objs], list(range(WARMUP)))
+        obj = C()
+        f(obj, 1)
+        f(obj, 2)
+        self.assertEqual(obj.__dict__, {"x": 2})
+        del obj.x
+        f(obj, 3)
+        self.assertEqual(obj.x, 3)
+
+        # A data descriptor added after specialization must be honoured
+        stored = []
+        C.x = property(lambda self: 42, lambda self, v: stored.append(v))
+        f(obj, 4)
+        self.assertEqual(stored, [4])
+        self.assertEqual(obj.x, 42)
+
+    def test_class_attribute_default(self):
+        class C:
+            x = 0
+        def f(obj, value):
+            obj.x = value
+        obj = C()
+        warm_up(f, obj, 1)
+        f(obj, 5)
+        self.assertEqual(obj.x, 5)
+        self.assertEqual(C.x, 0)
+
+    def test_slots(self):
+        class C:
+            __slots__ = ("x",)
+        def f(obj, value):
+            obj.x = value
+        obj = C()
+        warm_up(f, obj, [])
+        value = object()
+        f(obj, value)
+        self.assertIs(obj.x, value)
+
+        class D:
+            __slots__ = ("x",)
+        other = D()
+        f(other, 7)
+        self.assertEqual(other.x, 7)
+
+    def test_other_owners(self):
+        class C:
+            pass
+        def f(obj, value):
+            obj.x = value
+        warm_up(f, C(), 1)
+        f(C, 2)
+        self.assertEqual(C.x, 2)
+        with self.assertRaises(AttributeError):
+            f(object(), 3)
+
+
+class CallTests(unittest.TestCase):
+
+    def test_builtin_o(self):
+        def f(func, arg):
+            return func(arg)
+        warm_up(f, len, "abc")
+        self.assertEqual(f(len, [1, 2]), 2)
+        self.assertEqual(f(abs, -3), 3)
+        self.assertEqual(f(lambda x: x * 2, 4), 8)
+        with self.assertRaises(TypeError):
+            f(len, 1)
+
+    def test_builtin_fastcall(self):
+        def f(func, a, b):
+            return func(a, b)
+        warm_up(f, isinstance, 1, int)
+        self.assertTrue(f(isinstance, "a", str))
+        self.assertEqual(f(divmod, 7, 2), (3, 1))
+        with self.assertRaises(TypeError):
+            f(isinstance, 1, 2)
+
+    def test_method_descriptor(self):
+        def f(seq, item):
+            seq.append(item)
+            return seq.pop()
+        warm_up(f, [], 1)
+        self.assertEqual(f([], 2), 2)
+
+        class MyList(list):
+            def append(self, item):
+                list.append(self, item * 10)
+        self.assertEqual(f(MyList(), 3), 30)
+
+        def g(d, key):
+            return d.get(key, 0)
+        warm_up(g, {"a": 1}, "a")
+        self.assertEqual(g({}, "a"), 0)
+        self.assertEqual(g({"a": 2}, "a"), 2)
+
+    def test_descriptor_self_type(self):
+        def f(meth, obj, arg):
+            return meth(obj, arg)
+        warm_up(f, list.append, [], 1)
+        with self.assertRaises(TypeError):
+            f(list.append, (), 1)
+
+    def test_store_attr_descriptor_added_after_optimization(self):
+        class Descriptor:
+            pass
+
+        class C:
+            x = Descriptor()
+
+        def f(o, value):
+            o.x = value
+
+        o = C()
+        warm_up(f, o, 1)
+
+        stored = []
+        Descriptor.__get__ = lambda self, instance, owner: 2
+        Descriptor.__set__ = lambda self, instance, value: stored.append(value)
+
+        f(o, 3)
+        self.assertEqual(stored, [3])
+        self.assertEqual(o.x, 2)
+
+
+class SuperinstructionTests(unittest.TestCase):
+    # Hot code objects run a copy of their bytecode where frequent pairs
+    # such as LOAD_FAST LOAD_FAST are fused into one instruction.
+
+    def test_results(self):
+        def f(a, b):
+            c = a
+            d = c
+            x = a.real
+            y = 1
+            return a + b + c + d + x + y
+        warm_up(f, 1, 2)
+        self.assertEqual(f(3, 4), 17)
+
+        def g(n):
+            if n:
+                return None
+            return 1
+        warm_up(g, 0)
+        self.assertIsNone(g(1))
+        self.assertEqual(g(0), 1)
+
+    def test_unbound_local(self):
+        def f(flag):
+            if flag:
+                a = b = 1
+            return (a,
+                    b)
+        warm_up(f, True)
+        with self.assertRaises(UnboundLocalError) as cm:
+            f(False)
+        self.assertIn("'a'", str(cm.exception))
+
+        def g(flag):
+            a = 1
+            if flag:
+                b = 2
+            return (a,
+                    b)
+        warm_up(g, True)
+        try:
+            g(False)
+        except UnboundLocalError as exc:
+            self.assertIn("'b'", str(exc))
+            self.assertEqual(last_lineno(exc), g.__code__.co_firstlineno + 5)
+        else:
+            self.fail("UnboundLocalError not raised")
+
+    def test_attribute_error_line(self):
+        def f(a):
+            b = a
+            return (b
+                    .missing)
+        class C:
+            missing = None
+        warm_up(f, C)
+        try:
+            f(object())
+        except AttributeError as exc:
+            self.assertEqual(last_lineno(exc), f.__code__.co_firstlineno + 3)
+        else:
+            self.fail("AttributeError not raised")
+
+    def test_line_tracing(self):
+        def f(a):
+            b = a
+            c = b
+            return c
+        def lines():
+            events = []
+            def tracer(frame, event, arg):
+                if frame.f_code is f.__code__ and event == 'line':
+                    events.append(frame.f_lineno - f.__code__.co_firstlineno)
+                return tracer
+            sys.settrace(tracer)
+            try:
+                f(1)
+            finally:
+                sys.settrace(None)
+            return events
+        expected = lines()
+        warm_up(f, 1)
+        self.assertEqual(lines(), expected)
+        self.assertEqual(expected, [1, 2, 3])
+
+    def test_co_code_unchanged(self):
+        def f(a, b):
+            return a + b
+        code = f.__code__.co_code
+        warm_up(f, 1, 2)
+        self.assertEqual(f.__code__.co_code, code)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -2,10 +2,12 @@
 
 #include "Python.h"
 #include "code.h"
+#define NEED_OPCODE_JUMP_TABLES
 #include "opcode.h"
 #include "structmember.h"         // PyMemberDef
 #include "pycore_code.h"          // _PyOpcache
 #include "pycore_interp.h"        // PyInterpreterState.co_extra_freefuncs
+#include "pycore_jit.h"           // _PyJIT_Free()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
 #include "clinic/codeobject.c.h"
@@ -266,6 +268,9 @@ PyCode_NewWithPosOnlyArgs(int argcount, int posonlyargcount, int kwonlyargcount,
 
     co->co_opcache_map = NULL;
     co->co_opcache = NULL;
+    co->co_exctable = NULL;
+    co->co_quickened = NULL;
+    co->co_jit = NULL;
     co->co_opcache_flag = 0;
     co->co_opcache_size = 0;
     return co;
@@ -302,12 +307,22 @@ _PyCode_InitOpcache(PyCodeObject *co)
         i++;  // 'i' is now aligned to (next_instr - first_instr)
 
         // TODO: LOAD_METHOD
-        if (opcode == LOAD_GLOBAL || opcode == LOAD_ATTR) {
+        switch (opcode) {
+        case LOAD_GLOBAL:
+        case LOAD_ATTR:
+        case STORE_ATTR:
+        case BINARY_ADD:
+        case BINARY_SUBTRACT:
+        case BINARY_SUBSCR:
+        case COMPARE_OP:
+        case CALL_FUNCTION:
+        case CALL_METHOD:
             opts++;
             co->co_opcache_map[i] = (unsigned char)opts;
-            if (opts > 254) {
-                break;
-            }
+            break;
+        }
+        if (opts > 254) {
+            break;
         }
     }
 
@@ -328,6 +343,332 @@ _PyCode_InitOpcache(PyCodeObject *co)
     return 0;
 }
 
+/* Opcode of the superinstruction fusing the pair first-second, or 0 */
+static int
+superinstruction(int first, int second)
+{
+    switch (first) {
+    case LOAD_FAST:
+        switch (second) {
+        case LOAD_FAST:
+            return LOAD_FAST__LOAD_FAST;
+        case LOAD_CONST:
+            return LOAD_FAST__LOAD_CONST;
+        case LOAD_ATTR:
+            return LOAD_FAST__LOAD_ATTR;
+        }
+        break;
+    case LOAD_CONST:
+        switch (second) {
+        case LOAD_FAST:
+            return LOAD_CONST__LOAD_FAST;
+        case RETURN_VALUE:
+            return LOAD_CONST__RETURN_VALUE;
+        }
+        break;
+    case STORE_FAST:
+        switch (second) {
+        case LOAD_FAST:
+            return STORE_FAST__LOAD_FAST;
+        case STORE_FAST:
+            return STORE_FAST__STORE_FAST;
+        }
+        break;
+    }
+    return 0;
+}
+
+/* Build co_quickened: a copy of co_code where the first instruction of each
+   fusable pair is replaced by the superinstruction, keeping its argument.
+   The second instruction is left as it is, so jumps to it still work and
+   instruction offsets are the same as in co_code.  A superinstruction only
+   looks at the argument of the second instruction, so the second one may be
+   the start of another pair. */
+int
+_PyCode_Quicken(PyCodeObject *co)
+{
+    Py_ssize_t size = PyBytes_GET_SIZE(co->co_code);
+    Py_ssize_t co_size = size / sizeof(_Py_CODEUNIT);
+    const _Py_CODEUNIT *opcodes = (_Py_CODEUNIT*)PyBytes_AS_STRING(co->co_code);
+    unsigned char *quickened = NULL;
+
+    for (Py_ssize_t i = 0; i + 1 < co_size; i++) {
+        int fused = superinstruction(_Py_OPCODE(opcodes[i]),
+                                     _Py_OPCODE(opcodes[i + 1]));
+        if (fused == 0) {
+            continue;
+        }
+        if (quickened == NULL) {
+            quickened = PyMem_Malloc(size);
+            if (quickened == NULL) {
+                PyErr_NoMemory();
+                return -1;
+            }
+            memcpy(quickened, opcodes, size);
+        }
+        /* Instructions are (opcode, argument) byte pairs */
+        quickened[i * sizeof(_Py_CODEUNIT)] = (unsigned char)fused;
+    }
+    co->co_quickened = (_Py_CODEUNIT *)quickened;
+    return 0;
+}
+
+/* Shared by code objects without try blocks and by code objects whose
+   bytecode could not be analysed.  Their try blocks are pushed on the frame's
+   block stack as they are entered. */
+static _PyExcTable exctable_none = {0, 0, NULL, NULL};
+
+#define EXCTABLE_UNVISITED (-2)
+
+typedef struct {
+    int len;
+    int stacksize;
+    int *block_at;      /* innermost block before each instruction */
+    int *depth_at;      /* stack depth before each instruction */
+    int *todo;
+    int ntodo;
+} exctable_state;
+
+/* Record that control reaches instruction 'i' with 'block' as the innermost
+   block and 'depth' items on the value stack.  Return 0 if that contradicts
+   an earlier visit. */
+static int
+exctable_flow(exctable_state *st, int i, int block, int depth)
+{
+    if (i < 0 || i >= st->len || depth < 0 || depth > st->stacksize) {
+        return 0;
+    }
+    if (st->block_at[i] == EXCTABLE_UNVISITED) {
+        st->block_at[i] = block;
+        st->depth_at[i] = depth;
+        st->todo[st->ntodo++] = i;
+        return 1;
+    }
+    return st->block_at[i] == block && st->depth_at[i] == depth;
+}
+
+static int
+exctable_oparg(const _Py_CODEUNIT *code, int i)
+{
+    int oparg = _Py_OPARG(code[i]);
+    for (int shift = 8; i > 0 && shift < 32; shift += 8) {
+        if (_Py_OPCODE(code[--i]) != EXTENDED_ARG) {
+            break;
+        }
+        oparg |= _Py_OPARG(code[i]) << shift;
+    }
+    return oparg;
+}
+
+/* Walk every reachable instruction, tracking the try blocks and the stack
+   depth the same way the compiler's stackdepth() pass does.  Each SETUP_*
+   instruction is visited once and introduces two blocks: a SETUP_FINALLY
+   block for its body and an EXCEPT_HANDLER block for its handler.  Return 0
+   if the bytecode is not consistent enough to describe it with a table. */
+static int
+exctable_analyze(exctable_state *st, const _Py_CODEUNIT *code,
+                 _PyExcTableBlock *blocks)
+{
+    int nblocks = 0;
+    int depth = (_Py_OPCODE(code[0]) == GEN_START);
+    if (!exctable_flow(st, 0, -1, depth)) {
+        return 0;
+    }
+    while (st->ntodo > 0) {
+        int i = st->todo[--st->ntodo];
+        int block = st->block_at[i];
+        depth = st->depth_at[i];
+        int opcode = _Py_OPCODE(code[i]);
+        if (opcode == EXTENDED_ARG) {
+            if (!exctable_flow(st, i + 1, block, depth)) {
+                return 0;
+            }
+            continue;
+        }
+        int oparg = HAS_ARG(opcode) ? exctable_oparg(code, i) : 0;
+        int effect = PyCompile_OpcodeStackEffectWithJump(opcode, oparg, 0);
+        if (effect == PY_INVALID_STACK_EFFECT) {
+            return 0;
+        }
+        switch (opcode) {
+            case SETUP_FINALLY:
+            case SETUP_WITH:
+            case SETUP_ASYNC_WITH: {
+                /* SETUP_ASYNC_WITH sets the block up below the result of
+                   __aenter__ */
+                int level = opcode == SETUP_ASYNC_WITH ? depth - 1 : depth;
+                int handler = i + 1 + oparg;
+                int nesting = 1;
+                for (int b = block; b >= 0; b = blocks[b].eb_parent) {
+                    nesting++;
+                }
+                if (nesting > CO_MAXBLOCKS) {
+                    return 0;
+                }
+                blocks[nblocks].eb_type = SETUP_FINALLY;
+                blocks[nblocks].eb_handler = handler;
+                blocks[nblocks].eb_level = level;
+                blocks[nblocks].eb_parent = block;
+                blocks[nblocks + 1].eb_type = EXCEPT_HANDLER;
+                blocks[nblocks + 1].eb_handler = -1;
+                blocks[nblocks + 1].eb_level = level;
+                blocks[nblocks + 1].eb_parent = block;
+                nblocks += 2;
+                /* The handler is entered with the previous and the current
+                   exception (3 items each) pushed above the block level */
+                if (!exctable_flow(st, i + 1, nblocks - 2, depth + effect) ||
+                    !exctable_flow(st, handler, nblocks - 1, level + 6))
+                {
+                    return 0;
+                }
+                continue;
+            }
+            case POP_BLOCK:
+                if (block < 0 || blocks[block].eb_type != SETUP_FINALLY) {
+                    return 0;
+                }
+                block = blocks[block].eb_parent;
+                break;
+            case POP_EXCEPT:
+            case END_ASYNC_FOR:
+                if (block < 0 || blocks[block].eb_type != EXCEPT_HANDLER) {
+                    return 0;
+                }
+                block = blocks[block].eb_parent;
+                break;
+        }
+        if (_PyOpcode_Jump[opcode/32] & (1U << (opcode%32))) {
+            int target = oparg;
+            if (_PyOpcode_RelativeJump[opcode/32] & (1U << (opcode%32))) {
+                target += i + 1;
+            }
+            int jump_effect = PyCompile_OpcodeStackEffectWithJump(opcode,
+                                                                  oparg, 1);
+            if (!exctable_flow(st, target, block, depth + jump_effect)) {
+                return 0;
+            }
+        }
+        switch (opcode) {
+            case JUMP_ABSOLUTE:
+            case JUMP_FORWARD:
+            case RETURN_VALUE:
+            case RAISE_VARARGS:
+            case RERAISE:
+                break;
+            default:
+                if (!exctable_flow(st, i + 1, block, depth + effect)) {
+                    return 0;
+                }
+        }
+    }
+    return 1;
+}
+
+int
+_PyCode_InitExcTable(PyCodeObject *co)
+{
+    const _Py_CODEUNIT *code = (_Py_CODEUNIT *)PyBytes_AS_STRING(co->co_code);
+    int len = (int)(PyBytes_GET_SIZE(co->co_code) / sizeof(_Py_CODEUNIT));
+    int nblocks = 0;
+
+    for (int i = 0; i < len; i++) {
+        switch (_Py_OPCODE(code[i])) {
+            case SETUP_FINALLY:
+            case SETUP_WITH:
+            case SETUP_ASYNC_WITH:
+                nblocks += 2;
+                break;
+        }
+    }
+    if (nblocks == 0) {
+        co->co_exctable = &exctable_none;
+        return 0;
+    }
+
+    exctable_state st = {len, co->co_stacksize, NULL, NULL, NULL, 0};
+    _PyExcTableBlock *blocks = PyMem_New(_PyExcTableBlock, nblocks);
+    st.block_at = PyMem_New(int, len);
+    st.depth_at = PyMem_New(int, len);
+    st.todo = PyMem_New(int, len);
+    if (blocks == NULL || st.block_at == NULL || st.depth_at == NULL ||
+        st.todo == NULL)
+    {
+        PyErr_NoMemory();
+        goto error;
+    }
+    for (int i = 0; i < len; i++) {
+        st.block_at[i] = EXCTABLE_UNVISITED;
+    }
+    if (!exctable_analyze(&st, code, blocks)) {
+        co->co_exctable = &exctable_none;
+        goto done;
+    }
+
+    /* Unreachable instructions are folded into the preceding range */
+    int nranges = 0;
+    int last = EXCTABLE_UNVISITED;
+    for (int i = 0; i < len; i++) {
+        if (st.block_at[i] != EXCTABLE_UNVISITED && st.block_at[i] != last) {
+            last = st.block_at[i];
+            nranges++;
+        }
+    }
+
+    _PyExcTable *table = PyMem_Malloc(sizeof(_PyExcTable) +
+                                      nblocks * sizeof(_PyExcTableBlock) +
+                                      nranges * sizeof(_PyExcTableRange));
+    if (table == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    table->et_nblocks = nblocks;
+    table->et_nranges = nranges;
+    table->et_blocks = (_PyExcTableBlock *)(table + 1);
+    table->et_ranges = (_PyExcTableRange *)(table->et_blocks + nblocks);
+    memcpy(table->et_blocks, blocks, nblocks * sizeof(_PyExcTableBlock));
+    nranges = 0;
+    last = EXCTABLE_UNVISITED;
+    for (int i = 0; i < len; i++) {
+        if (st.block_at[i] != EXCTABLE_UNVISITED && st.block_at[i] != last) {
+            last = st.block_at[i];
+            table->et_ranges[nranges].er_start = i;
+            table->et_ranges[nranges].er_block = last;
+            nranges++;
+        }
+    }
+    co->co_exctable = table;
+
+done:
+    PyMem_Free(blocks);
+    PyMem_Free(st.block_at);
+    PyMem_Free(st.depth_at);
+    PyMem_Free(st.todo);
+    return 0;
+
+error:
+    PyMem_Free(blocks);
+    PyMem_Free(st.block_at);
+    PyMem_Free(st.depth_at);
+    PyMem_Free(st.todo);
+    return -1;
+}
+
+int
+_PyExcTable_Lookup(const _PyExcTable *table, int lasti)
+{
+    int lo = 0, hi = table->et_nranges;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (table->et_ranges[mid].er_start <= lasti) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo == 0 ? -1 : table->et_ranges[lo - 1].er_block;
+}
+
 PyCodeObject *
 PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno)
 {
@@ -636,6 +977,15 @@ code_dealloc(PyCodeObject *co)
     if (co->co_opcache_map != NULL) {
         PyMem_Free(co->co_opcache_map);
     }
+    if (co->co_exctable != NULL && co->co_exctable != &exctable_none) {
+        PyMem_Free(co->co_exctable);
+    }
+    if (co->co_quickened != NULL) {
+        PyMem_Free(co->co_quickened);
+    }
+    if (co->co_jit != NULL) {
+        _PyJIT_Free(co->co_jit);
+    }
     co->co_opcache_flag = 0;
     co->co_opcache_size = 0;
 
@@ -692,6 +1042,17 @@ code_sizeof(PyCodeObject *co, PyObject *Py_UNUSED(args))
         // co_opcache
         res += co->co_opcache_size * sizeof(_PyOpcache);
     }
+    if (co->co_exctable != NULL && co->co_exctable != &exctable_none) {
+        res += sizeof(_PyExcTable) +
+               co->co_exctable->et_nblocks * sizeof(_PyExcTableBlock) +
+               co->co_exctable->et_nranges * sizeof(_PyExcTableRange);
+    }
+    if (co->co_quickened != NULL) {
+        res += PyBytes_GET_SIZE(co->co_code);
+    }
+    if (co->co_jit != NULL) {
+        res += co->co_jit->jc_size;
+    }
     return PyLong_FromSsize_t(res);
 }
 
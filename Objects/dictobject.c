@@ -1475,6 +1475,52 @@ _PyDict_GetItemHint(PyDictObject *mp, PyObject *key,
     return (mp->ma_keys->dk_lookup)(mp, key, hash, value);
 }
 
+/* Replace the value of an existing str key using an entry index hint, as
+   returned by _PyDict_GetItemHint().  Return 0 on success, or -1 without
+   an exception set if the hint does not match, in which case the caller
+   must fall back to a regular insertion. */
+int
+_PyDict_SetItemHint(PyDictObject *mp, PyObject *key,
+                    Py_ssize_t hint, PyObject *value)
+{
+    assert(PyDict_CheckExact((PyObject*)mp));
+    assert(PyUnicode_CheckExact(key));
+    assert(value != NULL);
+
+    if (hint < 0 || hint >= mp->ma_keys->dk_nentries) {
+        return -1;
+    }
+    PyDictKeyEntry *ep = DK_ENTRIES(mp->ma_keys) + (size_t)hint;
+    if (ep->me_key != key) {
+        return -1;
+    }
+
+    PyObject *old_value;
+    if (mp->ma_values != NULL) {
+        old_value = mp->ma_values[(size_t)hint];
+    }
+    else {
+        old_value = ep->me_value;
+    }
+    if (old_value == NULL) {
+        /* The key was deleted: inserting it again may change the order */
+        return -1;
+    }
+
+    Py_INCREF(value);
+    MAINTAIN_TRACKING(mp, key, value);
+    if (mp->ma_values != NULL) {
+        mp->ma_values[(size_t)hint] = value;
+    }
+    else {
+        ep->me_value = value;
+    }
+    mp->ma_version_tag = DICT_NEXT_VERSION();
+    Py_DECREF(old_value); /* which **CAN** re-enter (see issue #22653) */
+    ASSERT_CONSISTENT(mp);
+    return 0;
+}
+
 /* Same as PyDict_GetItemWithError() but with hash supplied by caller.
    This returns NULL *with* an exception set if an exception occurred.
    It returns NULL *without* an exception set if the key wasn't present.
@@ -2,6 +2,7 @@
 
 #include "Python.h"
 #include "pycore_ceval.h"         // _PyEval_BuiltinsFromGlobals()
+#include "pycore_code.h"          // _PyExcTable_Lookup()
 #include "pycore_moduleobject.h"  // _PyModule_GetDict()
 #include "pycore_object.h"        // _PyObject_GC_UNTRACK()
 
@@ -470,6 +471,10 @@ frame_setlineno(PyFrameObject *f, PyObject* p_new_lineno, void *Py_UNUSED(ignore
     }
 
     /* Unwind block stack. */
+    int has_exctable = _PyCode_HasExcTable(f->f_code);
+    if (has_exctable) {
+        _PyFrame_MaterializeBlocks(f, f->f_lasti);
+    }
     while (start_block_stack > best_block_stack) {
         Kind kind = top_block(start_block_stack);
         switch(kind) {
@@ -485,12 +490,18 @@ frame_setlineno(PyFrameObject *f, PyObject* p_new_lineno, void *Py_UNUSED(ignore
             frame_stack_pop(f);
             break;
         case Except:
+            if (has_exctable) {
+                _PyFrame_CompactBlocks(f);
+            }
             PyErr_SetString(PyExc_ValueError,
                 "can't jump out of an 'except' block");
             return -1;
         }
         start_block_stack = pop_block(start_block_stack);
     }
+    if (has_exctable) {
+        _PyFrame_CompactBlocks(f);
+    }
 
     /* Finally set the new f_lasti and return OK. */
     f->f_lineno = 0;
@@ -533,6 +544,155 @@ static PyGetSetDef frame_getsetlist[] = {
     {0}
 };
 
+/* Frames of Python-to-Python calls are carved out of per-thread chunks of
+   memory in LIFO order rather than taken from the zombie frame or the free
+   list below, so recursive and reentrant calls reuse memory that is still
+   hot in the cache instead of going back to the allocator.
+
+   A frame that outlives its call, because a traceback, sys._getframe() or a
+   younger frame's f_back still refers to it, stays where it is.  Its slot is
+   only marked as released when the frame is deallocated, and the top of the
+   stack moves down over released slots.  Chunks of a cleared thread state
+   are freed once their last frame goes away. */
+
+#define FRAMESTACK_CHUNK_SIZE (16 * 1024)
+
+typedef struct _PyFrameStackChunk {
+    struct _PyFrameStackChunk *previous;
+    struct _PyFrameStackChunk *next;
+    PyThreadState *owner;       /* NULL once the thread state is cleared */
+    char *top;                  /* first free byte */
+    char *limit;                /* end of the chunk */
+    Py_ssize_t nlive;           /* slots not released yet */
+} _PyFrameStackChunk;
+
+/* Each slot is followed by the GC header and the frame object */
+typedef struct _PyFrameStackSlot {
+    struct _PyFrameStackSlot *previous;  /* slot allocated before this one */
+    _PyFrameStackChunk *chunk;
+    int released;
+} _PyFrameStackSlot;
+
+#define FRAMESTACK_SLOT(f) (((_PyFrameStackSlot *)_Py_AS_GC(f)) - 1)
+
+static void
+framestack_free_chunk(_PyFrameStackChunk *chunk)
+{
+    if (chunk->previous != NULL) {
+        chunk->previous->next = chunk->next;
+    }
+    if (chunk->next != NULL) {
+        chunk->next->previous = chunk->previous;
+    }
+    if (chunk->owner != NULL && chunk->owner->framestack_chunk == chunk) {
+        chunk->owner->framestack_chunk = chunk->previous;
+    }
+    PyMem_Free(chunk);
+}
+
+static PyFrameObject *
+framestack_alloc(PyThreadState *tstate, Py_ssize_t extras)
+{
+    size_t size = sizeof(_PyFrameStackSlot) + sizeof(PyGC_Head) +
+                  _PyObject_VAR_SIZE(&PyFrame_Type, extras);
+    _PyFrameStackChunk *chunk = tstate->framestack_chunk;
+    if (chunk == NULL || (size_t)(chunk->limit - chunk->top) < size) {
+        /* Move on to the spare chunk left by framestack_release() */
+        _PyFrameStackChunk *next = chunk != NULL ? chunk->next : NULL;
+        if (next != NULL && (size_t)(next->limit - next->top) < size) {
+            framestack_free_chunk(next);
+            next = NULL;
+        }
+        if (next == NULL) {
+            size_t chunk_size = Py_MAX(FRAMESTACK_CHUNK_SIZE,
+                                       sizeof(_PyFrameStackChunk) + size);
+            next = PyMem_Malloc(chunk_size);
+            if (next == NULL) {
+                PyErr_NoMemory();
+                return NULL;
+            }
+            next->previous = chunk;
+            next->next = NULL;
+            next->owner = tstate;
+            next->top = (char *)(next + 1);
+            next->limit = (char *)next + chunk_size;
+            next->nlive = 0;
+            if (chunk != NULL) {
+                chunk->next = next;
+            }
+        }
+        tstate->framestack_chunk = chunk = next;
+    }
+
+    _PyFrameStackSlot *slot = (_PyFrameStackSlot *)chunk->top;
+    chunk->top += size;
+    chunk->nlive++;
+    slot->previous = tstate->framestack_top;
+    slot->chunk = chunk;
+    slot->released = 0;
+    tstate->framestack_top = slot;
+
+    PyGC_Head *gc = (PyGC_Head *)(slot + 1);
+    gc->_gc_next = 0;
+    gc->_gc_prev = 0;
+    PyFrameObject *f = (PyFrameObject *)(gc + 1);
+    _PyObject_InitVar((PyVarObject *)f, &PyFrame_Type, extras);
+    return f;
+}
+
+static void
+framestack_release(PyFrameObject *f)
+{
+    _PyFrameStackSlot *slot = FRAMESTACK_SLOT(f);
+    _PyFrameStackChunk *chunk = slot->chunk;
+    PyThreadState *tstate = chunk->owner;
+    slot->released = 1;
+    chunk->nlive--;
+    if (tstate == NULL) {
+        if (chunk->nlive == 0) {
+            framestack_free_chunk(chunk);
+        }
+        return;
+    }
+    if (slot != tstate->framestack_top) {
+        /* Still below a live frame */
+        return;
+    }
+    while ((slot = tstate->framestack_top) != NULL && slot->released) {
+        tstate->framestack_top = slot->previous;
+        chunk = slot->chunk;
+        chunk->top = (char *)slot;
+    }
+    /* Allocation resumes where the last popped slot was.  The chunks above
+       it are empty: keep one of them as a spare so that recursing back and
+       forth over a chunk boundary does not allocate a chunk every time. */
+    tstate->framestack_chunk = chunk;
+    if (chunk->next != NULL) {
+        while (chunk->next->next != NULL) {
+            framestack_free_chunk(chunk->next->next);
+        }
+    }
+}
+
+void
+_PyFrame_ClearStack(PyThreadState *tstate)
+{
+    _PyFrameStackChunk *chunk = tstate->framestack_chunk;
+    while (chunk != NULL && chunk->next != NULL) {
+        chunk = chunk->next;
+    }
+    while (chunk != NULL) {
+        _PyFrameStackChunk *previous = chunk->previous;
+        chunk->owner = NULL;
+        if (chunk->nlive == 0) {
+            framestack_free_chunk(chunk);
+        }
+        chunk = previous;
+    }
+    tstate->framestack_chunk = NULL;
+    tstate->framestack_top = NULL;
+}
+
 /* Stack frames are allocated and deallocated at a considerable rate.
    In an attempt to improve the speed of function calls, we:
 
@@ -604,7 +764,10 @@ frame_dealloc(PyFrameObject *f)
     Py_CLEAR(f->f_trace);
 
     PyCodeObject *co = f->f_code;
-    if (co->co_zombieframe == NULL) {
+    if (f->f_stacked) {
+        framestack_release(f);
+    }
+    else if (co->co_zombieframe == NULL) {
         co->co_zombieframe = f;
     }
     else {
@@ -828,26 +991,16 @@ frame_alloc(PyCodeObject *code)
 }
 
 
-PyFrameObject* _Py_HOT_FUNCTION
-_PyFrame_New_NoTrack(PyThreadState *tstate, PyFrameConstructor *con, PyObject *locals)
+static inline void
+frame_init(PyFrameObject *f, PyThreadState *tstate, PyFrameConstructor *con,
+           PyObject *locals)
 {
-    assert(con != NULL);
-    assert(con->fc_globals != NULL);
-    assert(con->fc_builtins != NULL);
-    assert(con->fc_code != NULL);
-    assert(locals == NULL || PyMapping_Check(locals));
-
-    PyFrameObject *f = frame_alloc((PyCodeObject *)con->fc_code);
-    if (f == NULL) {
-        return NULL;
-    }
-
     f->f_back = (PyFrameObject*)Py_XNewRef(tstate->frame);
     f->f_code = (PyCodeObject *)Py_NewRef(con->fc_code);
     f->f_builtins = Py_NewRef(con->fc_builtins);
     f->f_globals = Py_NewRef(con->fc_globals);
     f->f_locals = Py_XNewRef(locals);
-    // f_valuestack initialized by frame_alloc()
+    // f_valuestack initialized by the caller
     f->f_trace = NULL;
     f->f_stackdepth = 0;
     f->f_trace_lines = 1;
@@ -857,7 +1010,60 @@ _PyFrame_New_NoTrack(PyThreadState *tstate, PyFrameConstructor *con, PyObject *l
     f->f_lineno = 0;
     f->f_iblock = 0;
     f->f_state = FRAME_CREATED;
-    // f_blockstack and f_localsplus initialized by frame_alloc()
+    // f_blockstack and f_localsplus initialized by the caller
+}
+
+PyFrameObject* _Py_HOT_FUNCTION
+_PyFrame_New_NoTrack(PyThreadState *tstate, PyFrameConstructor *con, PyObject *locals)
+{
+    assert(con != NULL);
+    assert(con->fc_globals != NULL);
+    assert(con->fc_builtins != NULL);
+    assert(con->fc_code != NULL);
+    assert(locals == NULL || PyMapping_Check(locals));
+
+    PyFrameObject *f = frame_alloc((PyCodeObject *)con->fc_code);
+    if (f == NULL) {
+        return NULL;
+    }
+    frame_init(f, tstate, con, locals);
+    f->f_stacked = 0;
+    return f;
+}
+
+/* Like _PyFrame_New_NoTrack(), but take the frame from the thread's frame
+   stack.  Only for frames that are evaluated right away and whose call
+   returns before the caller's does. */
+PyFrameObject* _Py_HOT_FUNCTION
+_PyFrame_NewStacked_NoTrack(PyThreadState *tstate, PyFrameConstructor *con,
+                            PyObject *locals)
+{
+    assert(con != NULL);
+    assert(con->fc_globals != NULL);
+    assert(con->fc_builtins != NULL);
+    assert(con->fc_code != NULL);
+    assert(locals == NULL || PyMapping_Check(locals));
+
+    /* The zombie frame is already initialized: only nested and recursive
+       calls of the same code object need a frame from the stack */
+    PyCodeObject *code = (PyCodeObject *)con->fc_code;
+    if (code->co_zombieframe != NULL) {
+        return _PyFrame_New_NoTrack(tstate, con, locals);
+    }
+
+    Py_ssize_t nslots = code->co_nlocals +
+                        PyTuple_GET_SIZE(code->co_cellvars) +
+                        PyTuple_GET_SIZE(code->co_freevars);
+    PyFrameObject *f = framestack_alloc(tstate, nslots + code->co_stacksize);
+    if (f == NULL) {
+        return NULL;
+    }
+    f->f_valuestack = f->f_localsplus + nslots;
+    for (Py_ssize_t i = 0; i < nslots; i++) {
+        f->f_localsplus[i] = NULL;
+    }
+    frame_init(f, tstate, con, locals);
+    f->f_stacked = 1;
     return f;
 }
 
@@ -914,6 +1120,54 @@ PyFrame_BlockPop(PyFrameObject *f)
     return b;
 }
 
+/* For code with an exception table only the EXCEPT_HANDLER blocks live on
+   f_blockstack.  Rebuild the full block stack active at instruction 'lasti'
+   by interleaving them with the SETUP_FINALLY blocks from the table, so the
+   stack can be unwound as usual. */
+void
+_PyFrame_MaterializeBlocks(PyFrameObject *f, int lasti)
+{
+    const _PyExcTable *table = f->f_code->co_exctable;
+    int innermost = _PyExcTable_Lookup(table, lasti);
+    int n = 0;
+    for (int b = innermost; b >= 0; b = table->et_blocks[b].eb_parent) {
+        n++;
+    }
+    assert(n <= CO_MAXBLOCKS);
+
+    /* Fill from the top down so the handler blocks can be moved in place */
+    int handlers = f->f_iblock;
+    f->f_iblock = n;
+    for (int b = innermost; b >= 0; b = table->et_blocks[b].eb_parent) {
+        const _PyExcTableBlock *eb = &table->et_blocks[b];
+        n--;
+        if (eb->eb_type == EXCEPT_HANDLER) {
+            handlers--;
+            assert(handlers >= 0 && handlers <= n);
+            f->f_blockstack[n] = f->f_blockstack[handlers];
+        }
+        else {
+            f->f_blockstack[n].b_type = SETUP_FINALLY;
+            f->f_blockstack[n].b_handler = eb->eb_handler;
+            f->f_blockstack[n].b_level = eb->eb_level;
+        }
+    }
+    assert(handlers == 0);
+}
+
+/* Undo _PyFrame_MaterializeBlocks() once the block stack has been unwound */
+void
+_PyFrame_CompactBlocks(PyFrameObject *f)
+{
+    int n = 0;
+    for (int i = 0; i < f->f_iblock; i++) {
+        if (f->f_blockstack[i].b_type == EXCEPT_HANDLER) {
+            f->f_blockstack[n++] = f->f_blockstack[i];
+        }
+    }
+    f->f_iblock = n;
+}
+
 /* Convert between "fast" version of locals and dictionary version.
 
    map and values are input arguments.  map is a tuple of strings.
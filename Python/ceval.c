@@ -15,6 +15,8 @@
 #include "pycore_ceval.h"         // _PyEval_SignalAsyncExc()
 #include "pycore_code.h"          // _PyCode_InitOpcache()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
+#include "pycore_jit.h"           // _PyJIT_Compile()
+#include "pycore_long.h"          // _PyLong_Add()
 #include "pycore_object.h"        // _PyObject_GC_TRACK()
 #include "pycore_pyerrors.h"      // _PyErr_Fetch()
 #include "pycore_pylifecycle.h"   // _PyErr_Print()
@@ -140,6 +142,11 @@ static size_t opcache_attr_hits = 0;
 static size_t opcache_attr_misses = 0;
 static size_t opcache_attr_deopts = 0;
 static size_t opcache_attr_total = 0;
+
+static size_t opcache_spec_opts = 0;
+static size_t opcache_spec_hits = 0;
+static size_t opcache_spec_misses = 0;
+static size_t opcache_spec_deopts = 0;
 #endif
 
 
@@ -409,6 +416,24 @@ _PyEval_Fini(void)
 
     fprintf(stderr, "-- Opcode cache LOAD_ATTR total    = %zd\n",
             opcache_attr_total);
+
+    fprintf(stderr, "\n");
+
+    fprintf(stderr, "-- Opcode cache specialized hits   = %zd (%d%%)\n",
+            opcache_spec_hits,
+            (int) (100.0 * opcache_spec_hits /
+                (opcache_spec_hits + opcache_spec_misses)));
+
+    fprintf(stderr, "-- Opcode cache specialized misses = %zd (%d%%)\n",
+            opcache_spec_misses,
+            (int) (100.0 * opcache_spec_misses /
+                (opcache_spec_hits + opcache_spec_misses)));
+
+    fprintf(stderr, "-- Opcode cache specialized opts   = %zd\n",
+            opcache_spec_opts);
+
+    fprintf(stderr, "-- Opcode cache specialized deopts = %zd\n",
+            opcache_spec_deopts);
 #endif
 }
 
@@ -1312,11 +1337,53 @@ eval_frame_handle_pending(PyThreadState *tstate)
 #endif
 
 
+/* A superinstruction runs the first instruction of a pair and then the
+   second one without dispatching: NEXT_INSTRUCTION() moves on to it and
+   GO_TO_INSTRUCTION() jumps to its handler. */
+#define NEXT_INSTRUCTION() \
+    do { \
+        f->f_lasti = INSTR_OFFSET(); \
+        NEXTOPARG(); \
+    } while (0)
+
+#if USE_COMPUTED_GOTOS
+#define GO_TO_INSTRUCTION(op) goto TARGET_##op
+#else
+#define GO_TO_INSTRUCTION(op) goto dispatch_opcode
+#endif
+
+static inline int
+unfused_opcode(int opcode)
+{
+    switch (opcode) {
+    case LOAD_FAST__LOAD_FAST:
+    case LOAD_FAST__LOAD_CONST:
+    case LOAD_FAST__LOAD_ATTR:
+        return LOAD_FAST;
+    case LOAD_CONST__LOAD_FAST:
+    case LOAD_CONST__RETURN_VALUE:
+        return LOAD_CONST;
+    case STORE_FAST__LOAD_FAST:
+    case STORE_FAST__STORE_FAST:
+        return STORE_FAST;
+    }
+    return opcode;
+}
+
+
 #define CHECK_EVAL_BREAKER() \
     if (_Py_atomic_load_relaxed(eval_breaker)) { \
         continue; \
     }
 
+/* Back to the machine code at a jump target after running instructions it
+   has no stencil for, or after handling eval_breaker */
+#define RESUME_JIT() \
+    if (use_jit && \
+        !(trace_info.cframe.use_tracing OR_DTRACE_LINE OR_LLTRACE)) { \
+        goto jit; \
+    }
+
 
 /* Tuple access macros */
 
@@ -1493,10 +1560,8 @@ eval_frame_handle_pending(PyThreadState *tstate)
     do { \
         if (co_opcache != NULL) { \
             co_opcache->optimized = -1; \
-            unsigned char co_opcache_offset = \
-                co->co_opcache_map[next_instr - first_instr]; \
-            assert(co_opcache_offset <= co->co_opcache_size); \
-            co->co_opcache_map[co_opcache_offset] = 0; \
+            assert(co->co_opcache_map[next_instr - first_instr] > 0); \
+            co->co_opcache_map[next_instr - first_instr] = 0; \
             co_opcache = NULL; \
         } \
     } while (0)
@@ -1516,6 +1581,42 @@ eval_frame_handle_pending(PyThreadState *tstate)
         } \
     } while (0)
 
+#define OPCACHE_DEOPT_SPECIALIZED() \
+    do { \
+        if (co_opcache != NULL) { \
+            OPCACHE_STAT_SPEC_DEOPT(); \
+            OPCACHE_DEOPT(); \
+        } \
+    } while (0)
+
+#define OPCACHE_MAYBE_DEOPT_SPECIALIZED() \
+    do { \
+        if (co_opcache != NULL) { \
+            OPCACHE_STAT_SPEC_MISS(); \
+            if (--co_opcache->optimized <= 0) { \
+                OPCACHE_DEOPT_SPECIALIZED(); \
+            } \
+        } \
+    } while (0)
+
+/* Pick the specialization of an adaptive opcode the first time it runs
+   with an opcache; the cache entry is dropped right away if the operands
+   are of a kind we don't specialize for. */
+#define OPCACHE_SPECIALIZE(KIND) \
+    do { \
+        if (co_opcache != NULL && co_opcache->optimized == 0) { \
+            int kind = (KIND); \
+            if (kind != _PyOpcache_GENERIC) { \
+                OPCACHE_STAT_SPEC_OPT(); \
+                co_opcache->u.sp.kind = kind; \
+                co_opcache->optimized = OPCODE_CACHE_MAX_TRIES; \
+            } \
+            else { \
+                OPCACHE_DEOPT_SPECIALIZED(); \
+            } \
+        } \
+    } while (0)
+
 #if OPCACHE_STATS
 
 #define OPCACHE_STAT_GLOBAL_HIT() \
@@ -1558,6 +1659,26 @@ eval_frame_handle_pending(PyThreadState *tstate)
         if (co->co_opcache != NULL) opcache_attr_total++; \
     } while (0)
 
+#define OPCACHE_STAT_SPEC_HIT() \
+    do { \
+        if (co->co_opcache != NULL) opcache_spec_hits++; \
+    } while (0)
+
+#define OPCACHE_STAT_SPEC_MISS() \
+    do { \
+        if (co->co_opcache != NULL) opcache_spec_misses++; \
+    } while (0)
+
+#define OPCACHE_STAT_SPEC_OPT() \
+    do { \
+        if (co->co_opcache != NULL) opcache_spec_opts++; \
+    } while (0)
+
+#define OPCACHE_STAT_SPEC_DEOPT() \
+    do { \
+        if (co->co_opcache != NULL) opcache_spec_deopts++; \
+    } while (0)
+
 #else /* OPCACHE_STATS */
 
 #define OPCACHE_STAT_GLOBAL_HIT()
@@ -1570,9 +1691,201 @@ eval_frame_handle_pending(PyThreadState *tstate)
 #define OPCACHE_STAT_ATTR_DEOPT()
 #define OPCACHE_STAT_ATTR_TOTAL()
 
+#define OPCACHE_STAT_SPEC_HIT()
+#define OPCACHE_STAT_SPEC_MISS()
+#define OPCACHE_STAT_SPEC_OPT()
+#define OPCACHE_STAT_SPEC_DEOPT()
+
 #endif
 
 
+/* Specialized forms of the adaptive opcodes.  The *_kind() functions
+   classify the operands of an instruction; once an opcache entry has
+   picked a kind, the same classification guards the specialized path. */
+
+static inline int
+opcache_binary_op_kind(PyObject *left, PyObject *right)
+{
+    if (PyLong_CheckExact(left) && PyLong_CheckExact(right)) {
+        return _PyOpcache_INT_INT;
+    }
+    if (PyFloat_CheckExact(left) && PyFloat_CheckExact(right)) {
+        return _PyOpcache_FLOAT_FLOAT;
+    }
+    return _PyOpcache_GENERIC;
+}
+
+static inline int
+opcache_compare_op_kind(PyObject *left, PyObject *right)
+{
+    if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
+        return _PyOpcache_STR_STR;
+    }
+    return opcache_binary_op_kind(left, right);
+}
+
+static inline int
+opcache_subscr_kind(PyObject *container, PyObject *sub)
+{
+    if (PyLong_CheckExact(sub)) {
+        if (PyList_CheckExact(container)) {
+            return _PyOpcache_LIST_INT;
+        }
+        if (PyTuple_CheckExact(container)) {
+            return _PyOpcache_TUPLE_INT;
+        }
+    }
+    else if (PyDict_CheckExact(container) && PyUnicode_CheckExact(sub)) {
+        return _PyOpcache_DICT_STR;
+    }
+    return _PyOpcache_GENERIC;
+}
+
+#define OPCACHE_CALL_FLAGS \
+    (METH_VARARGS | METH_FASTCALL | METH_NOARGS | METH_O | \
+     METH_KEYWORDS | METH_METHOD)
+
+/* For method descriptors, args[0] is self and is counted in nargs. */
+static inline int
+opcache_call_kind(PyObject *func, PyObject **args, Py_ssize_t nargs)
+{
+    if (PyCFunction_CheckExact(func)) {
+        int flags = PyCFunction_GET_FLAGS(func) & OPCACHE_CALL_FLAGS;
+        if (flags == METH_O && nargs == 1) {
+            return _PyOpcache_BUILTIN_O;
+        }
+        if (flags == METH_FASTCALL) {
+            return _PyOpcache_BUILTIN_FAST;
+        }
+    }
+    else if (Py_IS_TYPE(func, &PyMethodDescr_Type) && nargs >= 1) {
+        PyMethodDescrObject *descr = (PyMethodDescrObject *)func;
+        int flags = descr->d_method->ml_flags & OPCACHE_CALL_FLAGS;
+        if (!PyObject_TypeCheck(args[0], PyDescr_TYPE(descr))) {
+            /* Let the generic path raise the TypeError */
+            return _PyOpcache_GENERIC;
+        }
+        if (flags == METH_O && nargs == 2) {
+            return _PyOpcache_METHOD_O;
+        }
+        if (flags == METH_FASTCALL) {
+            return _PyOpcache_METHOD_FAST;
+        }
+    }
+    return _PyOpcache_GENERIC;
+}
+
+static inline PyObject *
+binary_op_specialized(int kind, int opcode, PyObject *left, PyObject *right)
+{
+    if (kind == _PyOpcache_INT_INT) {
+        if (opcode == BINARY_ADD) {
+            return _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
+        }
+        return _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
+    }
+    assert(kind == _PyOpcache_FLOAT_FLOAT);
+    double a = PyFloat_AS_DOUBLE(left);
+    double b = PyFloat_AS_DOUBLE(right);
+    return PyFloat_FromDouble(opcode == BINARY_ADD ? a + b : a - b);
+}
+
+static inline PyObject *
+compare_op_specialized(int kind, PyObject *left, PyObject *right, int op)
+{
+    if (kind == _PyOpcache_FLOAT_FLOAT) {
+        double a = PyFloat_AS_DOUBLE(left);
+        double b = PyFloat_AS_DOUBLE(right);
+        Py_RETURN_RICHCOMPARE(a, b, op);
+    }
+    /* Both operands have the same exact builtin type, so this is the
+       comparison PyObject_RichCompare() would end up calling. */
+    return Py_TYPE(left)->tp_richcompare(left, right, op);
+}
+
+static PyObject *
+binary_subscr_specialized(PyThreadState *tstate, int kind,
+                          PyObject *container, PyObject *sub)
+{
+    switch (kind) {
+    case _PyOpcache_LIST_INT:
+    case _PyOpcache_TUPLE_INT: {
+        Py_ssize_t i = PyLong_AsSsize_t(sub);
+        if (i == -1 && _PyErr_Occurred(tstate)) {
+            /* Let the generic path raise the IndexError */
+            _PyErr_Clear(tstate);
+            break;
+        }
+        Py_ssize_t size = Py_SIZE(container);
+        if (i < 0) {
+            i += size;
+        }
+        if ((size_t)i >= (size_t)size) {
+            break;
+        }
+        PyObject *res;
+        if (kind == _PyOpcache_LIST_INT) {
+            res = PyList_GET_ITEM(container, i);
+        }
+        else {
+            res = PyTuple_GET_ITEM(container, i);
+        }
+        Py_INCREF(res);
+        return res;
+    }
+    case _PyOpcache_DICT_STR: {
+        Py_hash_t hash = ((PyASCIIObject *)sub)->hash;
+        if (hash == -1) {
+            break;
+        }
+        PyObject *res = _PyDict_GetItem_KnownHash(container, sub, hash);
+        if (res == NULL) {
+            if (!_PyErr_Occurred(tstate)) {
+                _PyErr_SetKeyError(sub);
+            }
+            return NULL;
+        }
+        Py_INCREF(res);
+        return res;
+    }
+    }
+    return PyObject_GetItem(container, sub);
+}
+
+/* Call a builtin function or method descriptor directly, without going
+   through the vectorcall dispatch.  Tracing must be off. */
+static PyObject *
+call_builtin_specialized(PyThreadState *tstate, int kind, PyObject *func,
+                         PyObject **args, Py_ssize_t nargs)
+{
+    PyObject *res;
+    if (_Py_EnterRecursiveCall(tstate, " while calling a Python object")) {
+        return NULL;
+    }
+    switch (kind) {
+    case _PyOpcache_BUILTIN_O:
+        res = PyCFunction_GET_FUNCTION(func)(PyCFunction_GET_SELF(func),
+                                             args[0]);
+        break;
+    case _PyOpcache_BUILTIN_FAST:
+        res = ((_PyCFunctionFast)(void(*)(void))PyCFunction_GET_FUNCTION(func))(
+            PyCFunction_GET_SELF(func), args, nargs);
+        break;
+    case _PyOpcache_METHOD_O:
+        res = ((PyMethodDescrObject *)func)->d_method->ml_meth(args[0], args[1]);
+        break;
+    default:
+        assert(kind == _PyOpcache_METHOD_FAST);
+        res = ((_PyCFunctionFast)(void(*)(void))
+               ((PyMethodDescrObject *)func)->d_method->ml_meth)(
+            args[0], args + 1, nargs - 1);
+        break;
+    }
+    _Py_LeaveRecursiveCall(tstate);
+    return _Py_CheckFunctionResult(tstate, func, res, NULL);
+}
+
+
 PyObject* _Py_HOT_FUNCTION
 _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
 {
@@ -1594,6 +1907,10 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
     PyObject *retval = NULL;            /* Return value */
     _Py_atomic_int * const eval_breaker = &tstate->interp->ceval.eval_breaker;
     PyCodeObject *co;
+    int use_exctable;  /* try blocks are looked up in co->co_exctable */
+    int jit_compile = 0;  /* the code object just became hot */
+    int use_jit;       /* run co->co_jit where possible */
+    _PyJITResult jit_result;
 
     const _Py_CODEUNIT *first_instr;
     PyObject *names;
@@ -1672,7 +1989,12 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
     assert(PyBytes_GET_SIZE(co->co_code) <= INT_MAX);
     assert(PyBytes_GET_SIZE(co->co_code) % sizeof(_Py_CODEUNIT) == 0);
     assert(_Py_IS_ALIGNED(PyBytes_AS_STRING(co->co_code), sizeof(_Py_CODEUNIT)));
-    first_instr = (_Py_CODEUNIT *) PyBytes_AS_STRING(co->co_code);
+    if (co->co_quickened != NULL) {
+        first_instr = co->co_quickened;
+    }
+    else {
+        first_instr = (_Py_CODEUNIT *) PyBytes_AS_STRING(co->co_code);
+    }
     /*
        f->f_lasti refers to the index of the last instruction,
        unless it's -1 in which case next_instr should be first_instr.
@@ -1701,11 +2023,23 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
     f->f_state = FRAME_EXECUTING;
 
     if (co->co_opcache_flag < opcache_min_runs) {
+        if (_Py_global_config_jit == _PyJIT_ALWAYS) {
+            /* -X jit=always: every code object is hot */
+            co->co_opcache_flag = opcache_min_runs - 1;
+        }
         co->co_opcache_flag++;
         if (co->co_opcache_flag == opcache_min_runs) {
             if (_PyCode_InitOpcache(co) < 0) {
                 goto exit_eval_frame;
             }
+            jit_compile = 1;
+#ifndef DYNAMIC_EXECUTION_PROFILE
+            /* Used from the next call on.  Not with the execution profile,
+               whose pair counts are meant to pick superinstructions. */
+            if (_PyCode_Quicken(co) < 0) {
+                goto exit_eval_frame;
+            }
+#endif
 #if OPCACHE_STATS
             opcache_code_objects_extra_mem +=
                 PyBytes_Size(co->co_code) / sizeof(_Py_CODEUNIT) +
@@ -1715,6 +2049,22 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         }
     }
 
+    /* Built before the first frame of the code object runs, so every frame
+       of it agrees on whether try blocks are pushed on f_blockstack. */
+    if (co->co_exctable == NULL && _PyCode_InitExcTable(co) < 0) {
+        goto exit_eval_frame;
+    }
+    use_exctable = _PyCode_HasExcTable(co);
+
+    /* Compiled once the try blocks are known */
+    if (jit_compile && _PyJIT_Compile(co) < 0) {
+        goto exit_eval_frame;
+    }
+    /* The machine code looks globals up in exact dicts only */
+    use_jit = (co->co_jit != NULL &&
+               PyDict_CheckExact(f->f_globals) &&
+               PyDict_CheckExact(f->f_builtins));
+
 #ifdef LLTRACE
     {
         int r = _PyDict_ContainsId(f->f_globals, &PyId___ltrace__);
@@ -1736,6 +2086,12 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
     assert(!_PyErr_Occurred(tstate));
 #endif
 
+    if (use_jit && !(trace_info.cframe.use_tracing OR_DTRACE_LINE OR_LLTRACE) &&
+        !_Py_atomic_load_relaxed(eval_breaker))
+    {
+        goto jit;
+    }
+
 main_loop:
     for (;;) {
         assert(stack_pointer >= f->f_valuestack); /* else underflow */
@@ -1810,6 +2166,9 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             }
             NEXTOPARG();
         }
+        /* Run both instructions of a superinstruction through
+           tracing_dispatch, so each one gets its own line event. */
+        opcode = unfused_opcode(opcode);
     }
 
 #ifdef LLTRACE
@@ -1868,6 +2227,15 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        case TARGET(LOAD_FAST_AND_CLEAR): {
+            /* Pushes NULL if the local is unbound; it is only ever
+               consumed by STORE_FAST (see compiler_swap_inlined_locals()) */
+            PyObject *value = GETLOCAL(oparg);
+            GETLOCAL(oparg) = NULL;
+            PUSH(value);
+            DISPATCH();
+        }
+
         case TARGET(LOAD_CONST): {
             PREDICTED(LOAD_CONST);
             PyObject *value = GETITEM(consts, oparg);
@@ -1883,6 +2251,92 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        case TARGET(LOAD_FAST__LOAD_FAST): {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                goto unbound_local_error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            NEXT_INSTRUCTION();
+            value = GETLOCAL(oparg);
+            if (value == NULL) {
+                goto unbound_local_error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            DISPATCH();
+        }
+
+        case TARGET(LOAD_FAST__LOAD_CONST): {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                goto unbound_local_error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            NEXT_INSTRUCTION();
+            value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            PUSH(value);
+            DISPATCH();
+        }
+
+        case TARGET(LOAD_FAST__LOAD_ATTR): {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                goto unbound_local_error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            NEXT_INSTRUCTION();
+            GO_TO_INSTRUCTION(LOAD_ATTR);
+        }
+
+        case TARGET(LOAD_CONST__LOAD_FAST): {
+            PyObject *value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            PUSH(value);
+            NEXT_INSTRUCTION();
+            value = GETLOCAL(oparg);
+            if (value == NULL) {
+                goto unbound_local_error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            DISPATCH();
+        }
+
+        case TARGET(LOAD_CONST__RETURN_VALUE): {
+            PyObject *value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            PUSH(value);
+            NEXT_INSTRUCTION();
+            GO_TO_INSTRUCTION(RETURN_VALUE);
+        }
+
+        case TARGET(STORE_FAST__LOAD_FAST): {
+            PyObject *value = POP();
+            SETLOCAL(oparg, value);
+            NEXT_INSTRUCTION();
+            value = GETLOCAL(oparg);
+            if (value == NULL) {
+                goto unbound_local_error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            DISPATCH();
+        }
+
+        case TARGET(STORE_FAST__STORE_FAST): {
+            PyObject *value = POP();
+            SETLOCAL(oparg, value);
+            NEXT_INSTRUCTION();
+            value = POP();
+            SETLOCAL(oparg, value);
+            DISPATCH();
+        }
+
         case TARGET(POP_TOP): {
             PyObject *value = POP();
             Py_DECREF(value);
@@ -2069,18 +2523,23 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PyObject *right = POP();
             PyObject *left = TOP();
             PyObject *sum;
-            /* NOTE(vstinner): Please don't try to micro-optimize int+int on
-               CPython using bytecode, it is simply worthless.
-               See http://bugs.python.org/issue21955 and
-               http://bugs.python.org/issue10044 for the discussion. In short,
-               no patch shown any impact on a realistic benchmark, only a minor
-               speedup on microbenchmarks. */
-            if (PyUnicode_CheckExact(left) &&
+            OPCACHE_CHECK();
+            OPCACHE_SPECIALIZE(opcache_binary_op_kind(left, right));
+            if (co_opcache != NULL &&
+                opcache_binary_op_kind(left, right) == co_opcache->u.sp.kind)
+            {
+                OPCACHE_STAT_SPEC_HIT();
+                sum = binary_op_specialized(co_opcache->u.sp.kind, BINARY_ADD,
+                                            left, right);
+                Py_DECREF(left);
+            }
+            else if (PyUnicode_CheckExact(left) &&
                      PyUnicode_CheckExact(right)) {
                 sum = unicode_concatenate(tstate, left, right, f, next_instr);
                 /* unicode_concatenate consumed the ref to left */
             }
             else {
+                OPCACHE_MAYBE_DEOPT_SPECIALIZED();
                 sum = PyNumber_Add(left, right);
                 Py_DECREF(left);
             }
@@ -2094,7 +2553,20 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         case TARGET(BINARY_SUBTRACT): {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *diff = PyNumber_Subtract(left, right);
+            PyObject *diff;
+            OPCACHE_CHECK();
+            OPCACHE_SPECIALIZE(opcache_binary_op_kind(left, right));
+            if (co_opcache != NULL &&
+                opcache_binary_op_kind(left, right) == co_opcache->u.sp.kind)
+            {
+                OPCACHE_STAT_SPEC_HIT();
+                diff = binary_op_specialized(co_opcache->u.sp.kind,
+                                             BINARY_SUBTRACT, left, right);
+            }
+            else {
+                OPCACHE_MAYBE_DEOPT_SPECIALIZED();
+                diff = PyNumber_Subtract(left, right);
+            }
             Py_DECREF(right);
             Py_DECREF(left);
             SET_TOP(diff);
@@ -2106,7 +2578,20 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         case TARGET(BINARY_SUBSCR): {
             PyObject *sub = POP();
             PyObject *container = TOP();
-            PyObject *res = PyObject_GetItem(container, sub);
+            PyObject *res;
+            OPCACHE_CHECK();
+            OPCACHE_SPECIALIZE(opcache_subscr_kind(container, sub));
+            if (co_opcache != NULL &&
+                opcache_subscr_kind(container, sub) == co_opcache->u.sp.kind)
+            {
+                OPCACHE_STAT_SPEC_HIT();
+                res = binary_subscr_specialized(tstate, co_opcache->u.sp.kind,
+                                                container, sub);
+            }
+            else {
+                OPCACHE_MAYBE_DEOPT_SPECIALIZED();
+                res = PyObject_GetItem(container, sub);
+            }
             Py_DECREF(container);
             Py_DECREF(sub);
             SET_TOP(res);
@@ -2680,11 +3165,17 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         }
 
         case TARGET(POP_BLOCK): {
-            PyFrame_BlockPop(f);
+            if (!use_exctable) {
+                PyFrame_BlockPop(f);
+            }
             DISPATCH();
         }
 
         case TARGET(RERAISE): {
+            if (use_exctable) {
+                /* Before f_lasti is moved back to the original raise */
+                _PyFrame_MaterializeBlocks(f, f->f_lasti);
+            }
             assert(f->f_iblock > 0);
             if (oparg) {
                 f->f_lasti = f->f_blockstack[f->f_iblock-1].b_handler;
@@ -2694,7 +3185,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PyObject *tb = POP();
             assert(PyExceptionClass_Check(exc));
             _PyErr_Restore(tstate, exc, val, tb);
-            goto exception_unwind;
+            goto exception_unwind_blocks;
         }
 
         case TARGET(END_ASYNC_FOR): {
@@ -2845,13 +3336,107 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
             PyObject *v = SECOND();
+            PyTypeObject *type = Py_TYPE(owner);
+            _PyOpCodeOpt_LoadAttr *la;
             int err;
             STACK_SHRINK(2);
+
+            OPCACHE_CHECK();
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                la = &co_opcache->u.la;
+                if (la->type == type &&
+                    PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG) &&
+                    la->tp_version_tag == type->tp_version_tag)
+                {
+                    // The type has no data descriptor for this name.
+                    OPCACHE_STAT_SPEC_HIT();
+                    if (la->hint < -1) {
+                        // Slot hint: see LOAD_ATTR.
+                        PyObject **addr = (PyObject **)((char *)owner + ~la->hint);
+                        PyObject *old = *addr;
+                        *addr = v;  // steals the reference to v
+                        Py_XDECREF(old);
+                        Py_DECREF(owner);
+                        DISPATCH();
+                    }
+                    PyObject **dictptr = (PyObject **) ((char *)owner + type->tp_dictoffset);
+                    PyObject *dict = *dictptr;
+                    if (dict != NULL && PyDict_CheckExact(dict) &&
+                        _PyDict_SetItemHint((PyDictObject *)dict, name,
+                                            la->hint, v) == 0)
+                    {
+                        err = 0;
+                    }
+                    else {
+                        // New attribute or the hint is stale: a regular
+                        // store, still without looking up the type.
+                        err = _PyObjectDict_SetItem(type, dictptr, name, v);
+                    }
+                    Py_DECREF(v);
+                    Py_DECREF(owner);
+                    if (err != 0)
+                        goto error;
+                    DISPATCH();
+                }
+                OPCACHE_MAYBE_DEOPT_SPECIALIZED();
+            }
+
             err = PyObject_SetAttr(owner, name, v);
             Py_DECREF(v);
-            Py_DECREF(owner);
-            if (err != 0)
+            if (err != 0) {
+                Py_DECREF(owner);
                 goto error;
+            }
+
+            if (co_opcache != NULL && co_opcache->optimized == 0) {
+                Py_ssize_t hint = -1;
+                if (type->tp_setattro == PyObject_GenericSetAttr &&
+                    PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
+                {
+                    PyObject *descr = _PyType_Lookup(type, name);
+                    if (descr == NULL ||
+                        (Py_TYPE(descr)->tp_descr_set == NULL &&
+                         !PyType_HasFeature(Py_TYPE(descr), Py_TPFLAGS_HEAPTYPE)))
+                    {
+                        // The value went to the instance dict.  Only builtin
+                        // non-data descriptors are accepted as they cannot
+                        // grow a __set__ without changing our type version.
+                        PyObject *dict = type->tp_dictoffset > 0 ?
+                            *(PyObject **) ((char *)owner + type->tp_dictoffset) : NULL;
+                        if (dict != NULL && PyDict_CheckExact(dict)) {
+                            PyObject *res = NULL;
+                            hint = _PyDict_GetItemHint((PyDictObject *)dict,
+                                                       name, -1, &res);
+                            if (res == NULL) {
+                                _PyErr_Clear(tstate);
+                                hint = -1;
+                            }
+                        }
+                    }
+                    else if (Py_IS_TYPE(descr, &PyMemberDescr_Type)) {
+                        struct PyMemberDef *dmem =
+                            ((PyMemberDescrObject *)descr)->d_member;
+                        if (dmem->type == T_OBJECT_EX &&
+                            !(dmem->flags & READONLY))
+                        {
+                            assert(dmem->offset > 0);
+                            hint = ~dmem->offset;
+                        }
+                    }
+                }
+                if (hint != -1) {
+                    OPCACHE_STAT_SPEC_OPT();
+                    co_opcache->optimized = OPCODE_CACHE_MAX_TRIES;
+                    la = &co_opcache->u.la;
+                    la->type = type;
+                    la->tp_version_tag = type->tp_version_tag;
+                    la->hint = hint;
+                }
+                else {
+                    OPCACHE_DEOPT_SPECIALIZED();
+                }
+            }
+            Py_DECREF(owner);
             DISPATCH();
         }
 
@@ -3601,7 +4186,20 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             assert(oparg <= Py_GE);
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *res = PyObject_RichCompare(left, right, oparg);
+            PyObject *res;
+            OPCACHE_CHECK();
+            OPCACHE_SPECIALIZE(opcache_compare_op_kind(left, right));
+            if (co_opcache != NULL &&
+                opcache_compare_op_kind(left, right) == co_opcache->u.sp.kind)
+            {
+                OPCACHE_STAT_SPEC_HIT();
+                res = compare_op_specialized(co_opcache->u.sp.kind,
+                                             left, right, oparg);
+            }
+            else {
+                OPCACHE_MAYBE_DEOPT_SPECIALIZED();
+                res = PyObject_RichCompare(left, right, oparg);
+            }
             SET_TOP(res);
             Py_DECREF(left);
             Py_DECREF(right);
@@ -3752,6 +4350,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                 Py_DECREF(cond);
                 JUMPTO(oparg);
                 CHECK_EVAL_BREAKER();
+                RESUME_JIT();
                 DISPATCH();
             }
             err = PyObject_IsTrue(cond);
@@ -3761,6 +4360,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             else if (err == 0) {
                 JUMPTO(oparg);
                 CHECK_EVAL_BREAKER();
+                RESUME_JIT();
             }
             else
                 goto error;
@@ -3779,6 +4379,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                 Py_DECREF(cond);
                 JUMPTO(oparg);
                 CHECK_EVAL_BREAKER();
+                RESUME_JIT();
                 DISPATCH();
             }
             err = PyObject_IsTrue(cond);
@@ -3786,6 +4387,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             if (err > 0) {
                 JUMPTO(oparg);
                 CHECK_EVAL_BREAKER();
+                RESUME_JIT();
             }
             else if (err == 0)
                 ;
@@ -3847,6 +4449,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PREDICTED(JUMP_ABSOLUTE);
             JUMPTO(oparg);
             CHECK_EVAL_BREAKER();
+            RESUME_JIT();
             DISPATCH();
         }
 
@@ -4022,8 +4625,10 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         }
 
         case TARGET(SETUP_FINALLY): {
-            PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
-                               STACK_LEVEL());
+            if (!use_exctable) {
+                PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
+                                   STACK_LEVEL());
+            }
             DISPATCH();
         }
 
@@ -4053,12 +4658,14 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         }
 
         case TARGET(SETUP_ASYNC_WITH): {
-            PyObject *res = POP();
-            /* Setup the finally block before pushing the result
-               of __aenter__ on the stack. */
-            PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
-                               STACK_LEVEL());
-            PUSH(res);
+            if (!use_exctable) {
+                PyObject *res = POP();
+                /* Setup the finally block before pushing the result
+                   of __aenter__ on the stack. */
+                PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
+                                   STACK_LEVEL());
+                PUSH(res);
+            }
             DISPATCH();
         }
 
@@ -4084,8 +4691,10 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                 goto error;
             /* Setup the finally block before pushing the result
                of __enter__ on the stack. */
-            PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
-                               STACK_LEVEL());
+            if (!use_exctable) {
+                PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
+                                   STACK_LEVEL());
+            }
 
             PUSH(res);
             DISPATCH();
@@ -4163,6 +4772,34 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             sp = stack_pointer;
 
             meth = PEEK(oparg + 2);
+            OPCACHE_CHECK();
+            if (co_opcache != NULL) {
+                /* For a method call, `self` is the first argument */
+                Py_ssize_t nargs = meth == NULL ? oparg : oparg + 1;
+                PyObject **pfunc = sp - nargs - 1;
+                OPCACHE_SPECIALIZE(opcache_call_kind(*pfunc, pfunc + 1, nargs));
+                if (co_opcache != NULL && !trace_info.cframe.use_tracing) {
+                    int kind = co_opcache->u.sp.kind;
+                    if (opcache_call_kind(*pfunc, pfunc + 1, nargs) == kind) {
+                        OPCACHE_STAT_SPEC_HIT();
+                        res = call_builtin_specialized(tstate, kind, *pfunc,
+                                                       pfunc + 1, nargs);
+                        while (stack_pointer > pfunc) {
+                            PyObject *w = POP();
+                            Py_DECREF(w);
+                        }
+                        if (meth == NULL) {
+                            (void)POP(); /* POP the NULL. */
+                        }
+                        PUSH(res);
+                        if (res == NULL)
+                            goto error;
+                        CHECK_EVAL_BREAKER();
+                        DISPATCH();
+                    }
+                    OPCACHE_MAYBE_DEOPT_SPECIALIZED();
+                }
+            }
             if (meth == NULL) {
                 /* `meth` is NULL when LOAD_METHOD thinks that it's not
                    a method call.
@@ -4210,6 +4847,29 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PREDICTED(CALL_FUNCTION);
             PyObject **sp, *res;
             sp = stack_pointer;
+            OPCACHE_CHECK();
+            if (co_opcache != NULL) {
+                PyObject **pfunc = sp - oparg - 1;
+                OPCACHE_SPECIALIZE(opcache_call_kind(*pfunc, pfunc + 1, oparg));
+                if (co_opcache != NULL && !trace_info.cframe.use_tracing) {
+                    int kind = co_opcache->u.sp.kind;
+                    if (opcache_call_kind(*pfunc, pfunc + 1, oparg) == kind) {
+                        OPCACHE_STAT_SPEC_HIT();
+                        res = call_builtin_specialized(tstate, kind, *pfunc,
+                                                       pfunc + 1, oparg);
+                        while (stack_pointer > pfunc) {
+                            PyObject *w = POP();
+                            Py_DECREF(w);
+                        }
+                        PUSH(res);
+                        if (res == NULL)
+                            goto error;
+                        CHECK_EVAL_BREAKER();
+                        DISPATCH();
+                    }
+                    OPCACHE_MAYBE_DEOPT_SPECIALIZED();
+                }
+            }
             res = call_function(tstate, &trace_info, &sp, oparg, NULL);
             stack_pointer = sp;
             PUSH(res);
@@ -4431,6 +5091,42 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
            or goto error. */
         Py_UNREACHABLE();
 
+unbound_local_error:
+        /* LOAD_FAST in a superinstruction */
+        format_exc_check_arg(tstate, PyExc_UnboundLocalError,
+                             UNBOUNDLOCAL_ERROR_MSG,
+                             PyTuple_GetItem(co->co_varnames, oparg));
+        goto error;
+
+jit:
+        /* Run the machine code from next_instr on, see pycore_jit.h */
+        jit_result = _PyJIT_Enter(f, stack_pointer, tstate,
+                                  co->co_jit->jc_entries[INSTR_OFFSET()]);
+        stack_pointer = jit_result.stack_pointer;
+        switch (jit_result.status) {
+        case _PyJIT_RETURN:
+            retval = POP();
+            assert(f->f_iblock == 0);
+            assert(EMPTY());
+            f->f_state = FRAME_RETURNED;
+            f->f_stackdepth = 0;
+            goto exiting;
+        case _PyJIT_ERROR:
+            goto error;
+        case _PyJIT_TRACE:
+            /* Skip instruction f_lasti, which has run */
+            JUMPTO(f->f_lasti);
+            while (_Py_OPCODE(*next_instr) == EXTENDED_ARG) {
+                next_instr++;
+            }
+            next_instr++;
+            continue;
+        default:
+            assert(jit_result.status == _PyJIT_DEOPT);
+            JUMPTO(f->f_lasti);
+            continue;
+        }
+
 error:
         /* Double-check exception status. */
 #ifdef NDEBUG
@@ -4453,6 +5149,10 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                            tstate, f, &trace_info);
         }
 exception_unwind:
+        if (use_exctable) {
+            _PyFrame_MaterializeBlocks(f, f->f_lasti);
+        }
+exception_unwind_blocks:
         f->f_state = FRAME_UNWINDING;
         /* Unwind stacks if an exception occurred */
         while (f->f_iblock > 0) {
@@ -4503,6 +5203,13 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                 JUMPTO(handler);
                 /* Resume normal execution */
                 f->f_state = FRAME_EXECUTING;
+                if (use_exctable) {
+                    _PyFrame_CompactBlocks(f);
+                    /* f_lasti still points into the try body, whose blocks
+                       are gone: dispatch the handler without checking the
+                       eval breaker, which would unwind from f_lasti. */
+                    DISPATCH();
+                }
                 goto main_loop;
             }
         } /* unwind stack */
@@ -4786,8 +5493,14 @@ _PyEval_MakeFrameVector(PyThreadState *tstate,
     assert(con->fc_defaults == NULL || PyTuple_CheckExact(con->fc_defaults));
     const Py_ssize_t total_args = co->co_argcount + co->co_kwonlyargcount;
 
-    /* Create the frame */
-    PyFrameObject *f = _PyFrame_New_NoTrack(tstate, con, locals);
+    /* Create the frame.  Generator frames outlive the call. */
+    PyFrameObject *f;
+    if (co->co_flags & (CO_GENERATOR | CO_COROUTINE | CO_ASYNC_GENERATOR)) {
+        f = _PyFrame_New_NoTrack(tstate, con, locals);
+    }
+    else {
+        f = _PyFrame_NewStacked_NoTrack(tstate, con, locals);
+    }
     if (f == NULL) {
         return NULL;
     }
@@ -145,7 +145,7 @@ compiler IR.
 
 enum fblocktype { WHILE_LOOP, FOR_LOOP, TRY_EXCEPT, FINALLY_TRY, FINALLY_END,
                   WITH, ASYNC_WITH, HANDLER_CLEANUP, POP_VALUE, EXCEPTION_HANDLER,
-                  ASYNC_COMPREHENSION_GENERATOR };
+                  ASYNC_COMPREHENSION_GENERATOR, INLINED_COMPREHENSION };
 
 struct fblockinfo {
     enum fblocktype fb_type;
@@ -296,13 +296,15 @@ static int compiler_sync_comprehension_generator(
                                       struct compiler *c,
                                       asdl_comprehension_seq *generators, int gen_index,
                                       int depth,
-                                      expr_ty elt, expr_ty val, int type);
+                                      expr_ty elt, expr_ty val, int type,
+                                      int iter_on_stack);
 
 static int compiler_async_comprehension_generator(
                                       struct compiler *c,
                                       asdl_comprehension_seq *generators, int gen_index,
                                       int depth,
-                                      expr_ty elt, expr_ty val, int type);
+                                      expr_ty elt, expr_ty val, int type,
+                                      int iter_on_stack);
 
 static int compiler_pattern(struct compiler *, pattern_ty, pattern_context *);
 static int compiler_match(struct compiler *, stmt_ty);
@@ -1128,6 +1130,7 @@ stack_effect(int opcode, int oparg, int jump)
             return 1;
 
         case LOAD_FAST:
+        case LOAD_FAST_AND_CLEAR:
             return 1;
         case STORE_FAST:
             return -1;
@@ -1777,6 +1780,7 @@ compiler_unwind_fblock(struct compiler *c, struct fblockinfo *info,
         case WHILE_LOOP:
         case EXCEPTION_HANDLER:
         case ASYNC_COMPREHENSION_GENERATOR:
+        case INLINED_COMPREHENSION:
             return 1;
 
         case FOR_LOOP:
@@ -4566,16 +4570,17 @@ static int
 compiler_comprehension_generator(struct compiler *c,
                                  asdl_comprehension_seq *generators, int gen_index,
                                  int depth,
-                                 expr_ty elt, expr_ty val, int type)
+                                 expr_ty elt, expr_ty val, int type,
+                                 int iter_on_stack)
 {
     comprehension_ty gen;
     gen = (comprehension_ty)asdl_seq_GET(generators, gen_index);
     if (gen->is_async) {
         return compiler_async_comprehension_generator(
-            c, generators, gen_index, depth, elt, val, type);
+            c, generators, gen_index, depth, elt, val, type, iter_on_stack);
     } else {
         return compiler_sync_comprehension_generator(
-            c, generators, gen_index, depth, elt, val, type);
+            c, generators, gen_index, depth, elt, val, type, iter_on_stack);
     }
 }
 
@@ -4583,7 +4588,8 @@ static int
 compiler_sync_comprehension_generator(struct compiler *c,
                                       asdl_comprehension_seq *generators, int gen_index,
                                       int depth,
-                                      expr_ty elt, expr_ty val, int type)
+                                      expr_ty elt, expr_ty val, int type,
+                                      int iter_on_stack)
 {
     /* generate code for the iterator, then each of the ifs,
        and then write to the element */
@@ -4604,9 +4610,11 @@ compiler_sync_comprehension_generator(struct compiler *c,
     gen = (comprehension_ty)asdl_seq_GET(generators, gen_index);
 
     if (gen_index == 0) {
-        /* Receive outermost iter as an implicit argument */
-        c->u->u_argcount = 1;
-        ADDOP_I(c, LOAD_FAST, 0);
+        if (!iter_on_stack) {
+            /* Receive outermost iter as an implicit argument */
+            c->u->u_argcount = 1;
+            ADDOP_I(c, LOAD_FAST, 0);
+        }
     }
     else {
         /* Sub-iter - calculate on the fly */
@@ -4656,7 +4664,7 @@ compiler_sync_comprehension_generator(struct compiler *c,
     if (++gen_index < asdl_seq_LEN(generators))
         if (!compiler_comprehension_generator(c,
                                               generators, gen_index, depth,
-                                              elt, val, type))
+                                              elt, val, type, 0))
         return 0;
 
     /* only append after the last for generator */
@@ -4702,7 +4710,8 @@ static int
 compiler_async_comprehension_generator(struct compiler *c,
                                       asdl_comprehension_seq *generators, int gen_index,
                                       int depth,
-                                      expr_ty elt, expr_ty val, int type)
+                                      expr_ty elt, expr_ty val, int type,
+                                       int iter_on_stack)
 {
     comprehension_ty gen;
     basicblock *start, *if_cleanup, *except;
@@ -4718,9 +4727,11 @@ compiler_async_comprehension_generator(struct compiler *c,
     gen = (comprehension_ty)asdl_seq_GET(generators, gen_index);
 
     if (gen_index == 0) {
-        /* Receive outermost iter as an implicit argument */
-        c->u->u_argcount = 1;
-        ADDOP_I(c, LOAD_FAST, 0);
+        if (!iter_on_stack) {
+            /* Receive outermost iter as an implicit argument */
+            c->u->u_argcount = 1;
+            ADDOP_I(c, LOAD_FAST, 0);
+        }
     }
     else {
         /* Sub-iter - calculate on the fly */
@@ -4754,7 +4765,7 @@ compiler_async_comprehension_generator(struct compiler *c,
     if (++gen_index < asdl_seq_LEN(generators))
         if (!compiler_comprehension_generator(c,
                                               generators, gen_index, depth,
-                                              elt, val, type))
+                                              elt, val, type, 0))
         return 0;
 
     /* only append after the last for generator */
@@ -4796,6 +4807,136 @@ compiler_async_comprehension_generator(struct compiler *c,
     return 1;
 }
 
+/* Save (or restore) the iteration variables of an inlined comprehension.
+   Each variable x is moved to the hidden local ".x" and cleared, or moved
+   back from it.  Either may be unbound: LOAD_FAST_AND_CLEAR pushes NULL
+   then, and STORE_FAST of NULL unbinds the variable. */
+static int
+compiler_swap_inlined_locals(struct compiler *c, PyObject *names, int save)
+{
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(names); i++) {
+        PyObject *name = PyList_GET_ITEM(names, i);
+        PyObject *hidden = PyUnicode_FromFormat(".%U", name);
+        if (hidden == NULL) {
+            return 0;
+        }
+        int ok = (compiler_addop_o(c, LOAD_FAST_AND_CLEAR, c->u->u_varnames,
+                                   save ? name : hidden) &&
+                  compiler_addop_o(c, STORE_FAST, c->u->u_varnames,
+                                   save ? hidden : name));
+        Py_DECREF(hidden);
+        if (!ok) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Compile a comprehension that the symbol table inlined into the current
+   function (see is_inline_candidate() in symtable.c):
+
+       BUILD_LIST 0                 (BUILD_SET, BUILD_MAP)
+       <outermost iterable>
+       GET_ITER
+       <save iteration variables>
+       SETUP_FINALLY cleanup
+       <loop, as in the comprehension's own code object>
+       POP_BLOCK
+       <restore iteration variables>
+       JUMP_FORWARD exit
+   cleanup:
+       <restore iteration variables>
+       RERAISE
+   exit:
+
+   'names' lists the iteration variables.  The cleanup handler is left out
+   if the block stack is full. */
+static int
+compiler_inlined_comprehension(struct compiler *c, int type, PyObject *names,
+                               asdl_comprehension_seq *generators,
+                               expr_ty elt, expr_ty val)
+{
+    comprehension_ty outermost;
+    basicblock *body, *cleanup, *exit;
+    int protect = c->u->u_nfblocks < CO_MAXBLOCKS;
+    int op;
+
+    switch (type) {
+    case COMP_LISTCOMP:
+        op = BUILD_LIST;
+        break;
+    case COMP_SETCOMP:
+        op = BUILD_SET;
+        break;
+    case COMP_DICTCOMP:
+        op = BUILD_MAP;
+        break;
+    default:
+        PyErr_Format(PyExc_SystemError,
+                     "unknown comprehension type %d", type);
+        return 0;
+    }
+
+    body = compiler_new_block(c);
+    cleanup = compiler_new_block(c);
+    exit = compiler_new_block(c);
+    if (body == NULL || cleanup == NULL || exit == NULL)
+        return 0;
+
+    ADDOP_I(c, op, 0);
+    outermost = (comprehension_ty) asdl_seq_GET(generators, 0);
+    VISIT(c, expr, outermost->iter);
+    ADDOP(c, GET_ITER);
+    if (!compiler_swap_inlined_locals(c, names, 1))
+        return 0;
+    if (protect) {
+        ADDOP_JUMP(c, SETUP_FINALLY, cleanup);
+        compiler_use_next_block(c, body);
+        if (!compiler_push_fblock(c, INLINED_COMPREHENSION, body, NULL, NULL))
+            return 0;
+    }
+    if (!compiler_comprehension_generator(c, generators, 0, 0, elt,
+                                          val, type, 1))
+        return 0;
+    if (protect) {
+        compiler_pop_fblock(c, INLINED_COMPREHENSION, body);
+        ADDOP_NOLINE(c, POP_BLOCK);
+    }
+    if (!compiler_swap_inlined_locals(c, names, 0))
+        return 0;
+    if (protect) {
+        ADDOP_JUMP_NOLINE(c, JUMP_FORWARD, exit);
+        compiler_use_next_block(c, cleanup);
+        if (!compiler_swap_inlined_locals(c, names, 0))
+            return 0;
+        ADDOP_I(c, RERAISE, 0);
+        compiler_use_next_block(c, exit);
+    }
+    return 1;
+}
+
+/* The iteration variables of an inlined comprehension, in a new list */
+static PyObject *
+inlined_comprehension_locals(PySTEntryObject *entry)
+{
+    PyObject *names, *name, *v;
+    Py_ssize_t pos = 0;
+
+    names = PyList_New(0);
+    if (names == NULL)
+        return NULL;
+    while (PyDict_Next(entry->ste_symbols, &pos, &name, &v)) {
+        long flags = PyLong_AS_LONG(v);
+        if (!(flags & DEF_PARAM) &&
+            ((flags >> SCOPE_OFFSET) & SCOPE_MASK) == LOCAL &&
+            PyList_Append(names, name) < 0) {
+            Py_DECREF(names);
+            return NULL;
+        }
+    }
+    return names;
+}
+
 static int
 compiler_comprehension(struct compiler *c, expr_ty e, int type,
                        identifier name, asdl_comprehension_seq *generators, expr_ty elt,
@@ -4810,6 +4951,23 @@ compiler_comprehension(struct compiler *c, expr_ty e, int type,
 
     int is_async_function = c->u->u_ste->ste_coroutine;
 
+    if (type != COMP_GENEXP) {
+        PySTEntryObject *entry = PySymtable_Lookup(c->c_st, (void *)e);
+        if (entry == NULL)
+            return 0;
+        if (entry->ste_comp_inlined) {
+            PyObject *names = inlined_comprehension_locals(entry);
+            Py_DECREF(entry);
+            if (names == NULL)
+                return 0;
+            int ok = compiler_inlined_comprehension(c, type, names,
+                                                    generators, elt, val);
+            Py_DECREF(names);
+            return ok;
+        }
+        Py_DECREF(entry);
+    }
+
     outermost = (comprehension_ty) asdl_seq_GET(generators, 0);
     if (!compiler_enter_scope(c, name, COMPILER_SCOPE_COMPREHENSION,
                               (void *)e, e->lineno))
@@ -4848,7 +5006,7 @@ compiler_comprehension(struct compiler *c, expr_ty e, int type,
     }
 
     if (!compiler_comprehension_generator(c, generators, 0, 0, elt,
-                                          val, type))
+                                          val, type, 0))
         goto error_in_scope;
 
     if (type != COMP_GENEXP) {
@@ -3,6 +3,7 @@
 #include "pycore_getopt.h"        // _PyOS_GetOpt()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
 #include "pycore_interp.h"        // _PyInterpreterState.runtime
+#include "pycore_jit.h"           // _PyJIT_HOT
 #include "pycore_long.h"          // _PY_LONG_MAX_STR_DIGITS_THRESHOLD
 #include "pycore_pathconfig.h"    // _Py_path_config
 #include "pycore_pyerrors.h"      // _PyErr_Fetch()
@@ -99,6 +100,8 @@ static const char usage_3[] = "\
          -X int_max_str_digits=number: limit the size of int<->str conversions.\n\
              This helps avoid denial of service attacks when parsing untrusted data.\n\
              The default is sys.int_info.default_max_str_digits.  0 disables.\n\
+         -X jit: compile hot functions to machine code where supported.\n\
+             -X jit=always compiles every function on its first call.\n\
 \n\
 --check-hash-based-pycs always|default|never:\n\
     control how Python invalidates hash-based .pyc files\n\
@@ -129,6 +132,8 @@ static const char usage_6[] =
 "   when converting from a string and when converting an int back to a str.\n"
 "   A value of 0 disables the limit.  Conversions to or from bases 2, 4, 8,\n"
 "   16, and 32 are never limited.\n"
+"PYTHONJIT: if this variable is set to 1, compile hot functions to machine\n"
+"   code where supported; 'always' compiles every function (-X jit).\n"
 "PYTHONMALLOC: set the Python memory allocators and/or install debug hooks\n"
 "   on Python memory allocators. Use PYTHONMALLOC=debug to install debug\n"
 "   hooks.\n"
@@ -733,6 +738,8 @@ _PyConfig_InitCompatConfig(PyConfig *config)
 /* Excluded from public struct PyConfig for backporting reasons. */
 /* default to unconfigured, _PyLong_InitTypes() does the rest */
 int _Py_global_config_int_max_str_digits = -1;
+/* _PyJIT_OFF, _PyJIT_HOT or _PyJIT_ALWAYS; -1 until configured */
+int _Py_global_config_jit = -1;
 
 
 static void
@@ -1814,6 +1821,53 @@ config_init_int_max_str_digits(PyConfig *config)
     return _PyStatus_OK();
 }
 
+static int
+config_jit_mode(const wchar_t *value)
+{
+    if (value == NULL || wcscmp(value, L"1") == 0) {
+        return _PyJIT_HOT;
+    }
+    if (wcscmp(value, L"always") == 0) {
+        return _PyJIT_ALWAYS;
+    }
+    if (wcscmp(value, L"0") == 0) {
+        return _PyJIT_OFF;
+    }
+    return -1;
+}
+
+static PyStatus
+config_init_jit(PyConfig *config)
+{
+    int mode = _PyJIT_OFF;
+
+    const char *env = config_get_env(config, "PYTHONJIT");
+    if (env) {
+        if (strcmp(env, "1") == 0) {
+            mode = _PyJIT_HOT;
+        }
+        else if (strcmp(env, "always") == 0) {
+            mode = _PyJIT_ALWAYS;
+        }
+        else if (strcmp(env, "0") != 0) {
+            return _PyStatus_ERR("PYTHONJIT: invalid value; "
+                                 "must be 0, 1 or always");
+        }
+    }
+
+    const wchar_t *xoption = config_get_xoption(config, L"jit");
+    if (xoption) {
+        const wchar_t *sep = wcschr(xoption, L'=');
+        mode = config_jit_mode(sep ? sep + 1 : NULL);
+        if (mode < 0) {
+            return _PyStatus_ERR("-X jit: invalid value; "
+                                 "must be 0, 1 or always");
+        }
+    }
+    _Py_global_config_jit = mode;
+    return _PyStatus_OK();
+}
+
 static PyStatus
 config_init_pycache_prefix(PyConfig *config)
 {
@@ -1870,6 +1924,12 @@ config_read_complex_options(PyConfig *config)
             return status;
         }
     }
+    if (_Py_global_config_jit < 0) {
+        status = config_init_jit(config);
+        if (_PyStatus_EXCEPTION(status)) {
+            return status;
+        }
+    }
 
     if (config->pycache_prefix == NULL) {
         status = config_init_pycache_prefix(config);
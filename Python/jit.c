@@ -0,0 +1,599 @@
+/* Copy-and-patch JIT, see Include/internal/pycore_jit.h */
+
+#include "Python.h"
+#include "pycore_code.h"          // _PyCode_HasExcTable()
+#include "pycore_initconfig.h"    // _Py_global_config_jit
+#include "pycore_jit.h"
+#include "pycore_long.h"          // _PyLong_Add()
+#include "frameobject.h"
+#include "opcode.h"
+#include "structmember.h"         // PyMemberDef
+
+/* The stencils are only generated for x86-64 ELF with GCC-compatible
+   compilers (see Tools/jit/build.py). */
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#  define JIT_SUPPORTED 1
+#endif
+
+#ifdef JIT_SUPPORTED
+
+#include <sys/mman.h>             // mmap()
+#include <unistd.h>               // sysconf()
+
+typedef enum {
+    HOLE_BASE,          /* start of the stencil itself */
+    HOLE_CONTINUE,      /* machine code of the next instruction */
+    HOLE_TARGET,        /* machine code of the jump target */
+    HOLE_OPARG,
+    HOLE_OPERAND,
+    HOLE_INDEX,
+    HOLE_NEXT_INDEX,
+    HOLE_SYMBOL,        /* address of a C symbol */
+} JITHoleKind;
+
+typedef struct {
+    uint32_t offset;
+    uint16_t kind;      /* JITHoleKind */
+    uint16_t symbol;    /* index in symbols[] of HOLE_SYMBOL */
+    int64_t addend;
+} JITHole;
+
+typedef struct {
+    size_t size;
+    const unsigned char *code;  /* NULL if the opcode has no stencil */
+    size_t nholes;
+    const JITHole *holes;
+} JITStencil;
+
+#include "jit_stencils.h"
+
+#define SYMBOL_ADDRESS(name) (uintptr_t)&name,
+static const uintptr_t symbols[] = {
+    JIT_SYMBOLS(SYMBOL_ADDRESS)
+};
+#undef SYMBOL_ADDRESS
+
+static const Py_ssize_t layout[] = {_PyJIT_LAYOUT};
+
+/* 1 if the stencils were compiled for the struct layout of this build,
+   0 if they were not, -1 if not checked yet */
+static int layout_ok = -1;
+
+static int
+jit_available(void)
+{
+    if (layout_ok < 0) {
+        layout_ok = (sizeof(layout) == sizeof(jit_layout) &&
+                     memcmp(layout, jit_layout, sizeof(layout)) == 0);
+    }
+    return layout_ok;
+}
+
+/* The instruction at code[i], with its EXTENDED_ARG prefixes */
+typedef struct {
+    Py_ssize_t index;       /* of the first prefix */
+    Py_ssize_t next_index;
+    int opcode;
+    int oparg;
+} JITInstr;
+
+static Py_ssize_t
+read_instr(const _Py_CODEUNIT *code, Py_ssize_t size, Py_ssize_t i,
+           JITInstr *instr)
+{
+    instr->index = i;
+    instr->oparg = 0;
+    while (i < size - 1 && _Py_OPCODE(code[i]) == EXTENDED_ARG) {
+        instr->oparg = (instr->oparg | _Py_OPARG(code[i])) << 8;
+        i++;
+    }
+    instr->opcode = _Py_OPCODE(code[i]);
+    instr->oparg |= _Py_OPARG(code[i]);
+    instr->next_index = i + 1;
+    return instr->next_index;
+}
+
+static const JITStencil *
+get_stencil(int opcode, int use_exctable)
+{
+    if ((opcode == SETUP_FINALLY || opcode == POP_BLOCK) && !use_exctable) {
+        /* The interpreter pushes and pops the try block */
+        return &jit_stencils[0];
+    }
+    if (jit_stencils[opcode].code == NULL) {
+        return &jit_stencils[0];
+    }
+    return &jit_stencils[opcode];
+}
+
+static int
+jump_target(const JITInstr *instr)
+{
+    switch (instr->opcode) {
+    case JUMP_FORWARD:
+    case FOR_ITER:
+        return (int)instr->next_index + instr->oparg;
+    case JUMP_ABSOLUTE:
+    case POP_JUMP_IF_FALSE:
+    case POP_JUMP_IF_TRUE:
+    case JUMP_IF_FALSE_OR_POP:
+    case JUMP_IF_TRUE_OR_POP:
+        return instr->oparg;
+    }
+    return -1;
+}
+
+/* Values of the holes which depend on the instruction */
+static void
+instr_values(PyCodeObject *co, const _Py_CODEUNIT *code, Py_ssize_t size,
+             const JITInstr *instr, _PyJITCache *cache,
+             uintptr_t *oparg, uintptr_t *operand)
+{
+    *oparg = (uintptr_t)(intptr_t)instr->oparg;
+    *operand = 0;
+    switch (instr->opcode) {
+    case LOAD_CONST:
+        *operand = (uintptr_t)PyTuple_GET_ITEM(co->co_consts, instr->oparg);
+        break;
+    case STORE_ATTR:
+    case LOAD_METHOD:
+        *operand = (uintptr_t)PyTuple_GET_ITEM(co->co_names, instr->oparg);
+        break;
+    case LOAD_GLOBAL:
+        cache->lg.name = PyTuple_GET_ITEM(co->co_names, instr->oparg);
+        *operand = (uintptr_t)&cache->lg;
+        break;
+    case LOAD_ATTR:
+        cache->la.name = PyTuple_GET_ITEM(co->co_names, instr->oparg);
+        *operand = (uintptr_t)&cache->la;
+        break;
+    case LOAD_CLOSURE:
+    case LOAD_DEREF:
+    case STORE_DEREF:
+        /* Cells follow the locals in f_localsplus */
+        *oparg = (uintptr_t)(co->co_nlocals + instr->oparg);
+        break;
+    case BINARY_ADD:
+    case INPLACE_ADD:
+        /* The local a string concatenation is stored to, or -1; see
+           unicode_concatenate() in ceval.c */
+        if (instr->next_index < size &&
+            _Py_OPCODE(code[instr->next_index]) == STORE_FAST) {
+            *oparg = _Py_OPARG(code[instr->next_index]);
+        }
+        else {
+            *oparg = (uintptr_t)(intptr_t)-1;
+        }
+        break;
+    }
+}
+
+int
+_PyJIT_Compile(PyCodeObject *co)
+{
+    if (_Py_global_config_jit <= _PyJIT_OFF || !jit_available()) {
+        return 0;
+    }
+    if (co->co_jit != NULL ||
+        (co->co_flags & (CO_GENERATOR | CO_COROUTINE | CO_ASYNC_GENERATOR)))
+    {
+        /* Resuming a generator in the middle of the machine code is not
+           supported */
+        return 0;
+    }
+
+    const _Py_CODEUNIT *code = (const _Py_CODEUNIT *)PyBytes_AS_STRING(co->co_code);
+    Py_ssize_t size = PyBytes_GET_SIZE(co->co_code) / sizeof(_Py_CODEUNIT);
+    int use_exctable = _PyCode_HasExcTable(co);
+    struct _PyJITCode *jit = NULL;
+    size_t *offsets = NULL;
+    char *memory = MAP_FAILED;
+    size_t code_size = 0;
+    size_t alloc_size;
+    Py_ssize_t ncaches = 0;
+    JITInstr instr;
+
+    /* First pass: offsets of the machine code of each instruction.  The
+       EXTENDED_ARG prefixes share the code of their instruction, and a
+       final stencil gives control back if the bytecode runs off its end. */
+    offsets = PyMem_Malloc((size + 1) * sizeof(size_t));
+    if (offsets == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    for (Py_ssize_t i = 0; i < size; ) {
+        Py_ssize_t next = read_instr(code, size, i, &instr);
+        for (; i < next; i++) {
+            offsets[i] = code_size;
+        }
+        code_size += get_stencil(instr.opcode, use_exctable)->size;
+        if (instr.opcode == LOAD_GLOBAL || instr.opcode == LOAD_ATTR) {
+            ncaches++;
+        }
+    }
+    offsets[size] = code_size;
+    code_size += jit_stencils[0].size;
+
+    jit = PyMem_Malloc(offsetof(struct _PyJITCode, jc_entries) +
+                       (size + 1) * sizeof(_PyJITFunction));
+    if (jit == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    jit->jc_caches = PyMem_Calloc(ncaches ? ncaches : 1, sizeof(_PyJITCache));
+    if (jit->jc_caches == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0) {
+        page_size = 4096;
+    }
+    alloc_size = (code_size + page_size - 1) / page_size * page_size;
+    memory = mmap(NULL, alloc_size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        /* Keep interpreting the code object */
+        goto error;
+    }
+
+    /* Second pass: copy and patch the stencils */
+    _PyJITCache *cache = jit->jc_caches;
+    for (Py_ssize_t i = 0; i <= size; ) {
+        const JITStencil *stencil;
+        uintptr_t oparg = 0, operand = 0;
+        int target = -1;
+        if (i < size) {
+            i = read_instr(code, size, i, &instr);
+            stencil = get_stencil(instr.opcode, use_exctable);
+            instr_values(co, code, size, &instr, cache, &oparg, &operand);
+            if (instr.opcode == LOAD_GLOBAL || instr.opcode == LOAD_ATTR) {
+                cache++;
+            }
+            target = jump_target(&instr);
+            if (target < 0 || target > size) {
+                target = (int)size;
+            }
+        }
+        else {
+            instr.index = instr.next_index = size;
+            stencil = &jit_stencils[0];
+            i++;
+        }
+        char *base = memory + offsets[instr.index];
+        memcpy(base, stencil->code, stencil->size);
+        for (size_t h = 0; h < stencil->nholes; h++) {
+            const JITHole *hole = &stencil->holes[h];
+            uintptr_t value = 0;
+            switch (hole->kind) {
+            case HOLE_BASE:
+                value = (uintptr_t)base;
+                break;
+            case HOLE_CONTINUE:
+                value = (uintptr_t)(memory + offsets[instr.next_index]);
+                break;
+            case HOLE_TARGET:
+                value = (uintptr_t)(memory + offsets[target]);
+                break;
+            case HOLE_OPARG:
+                value = oparg;
+                break;
+            case HOLE_OPERAND:
+                value = operand;
+                break;
+            case HOLE_INDEX:
+                value = (uintptr_t)instr.index;
+                break;
+            case HOLE_NEXT_INDEX:
+                value = (uintptr_t)instr.next_index;
+                break;
+            case HOLE_SYMBOL:
+                value = symbols[hole->symbol];
+                break;
+            }
+            value += (uintptr_t)hole->addend;
+            memcpy(base + hole->offset, &value, sizeof(value));
+        }
+    }
+
+    if (mprotect(memory, alloc_size, PROT_READ | PROT_EXEC) != 0) {
+        goto error;
+    }
+    jit->jc_memory = memory;
+    jit->jc_size = alloc_size;
+    for (Py_ssize_t i = 0; i <= size; i++) {
+        jit->jc_entries[i] = (_PyJITFunction)(memory + offsets[i]);
+    }
+    PyMem_Free(offsets);
+    co->co_jit = jit;
+    return 0;
+
+error:
+    if (memory != MAP_FAILED) {
+        munmap(memory, alloc_size);
+    }
+    if (jit != NULL) {
+        PyMem_Free(jit->jc_caches);
+        PyMem_Free(jit);
+    }
+    PyMem_Free(offsets);
+    return PyErr_Occurred() ? -1 : 0;
+}
+
+void
+_PyJIT_Free(struct _PyJITCode *jit)
+{
+    munmap(jit->jc_memory, jit->jc_size);
+    PyMem_Free(jit->jc_caches);
+    PyMem_Free(jit);
+}
+
+/* The stencils are compiled with the callee-saved registers but %rbp made
+   call-clobbered (see Tools/jit/build.py): save them here, once for every
+   run of the machine code.  Five pushes keep the stack 16-byte aligned. */
+__asm__(
+    ".text\n"
+    ".globl _PyJIT_Enter\n"
+    ".hidden _PyJIT_Enter\n"
+    ".type _PyJIT_Enter, @function\n"
+    "_PyJIT_Enter:\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    callq *%rcx\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    retq\n"
+    ".size _PyJIT_Enter, .-_PyJIT_Enter\n"
+);
+
+#else /* !JIT_SUPPORTED */
+
+int
+_PyJIT_Compile(PyCodeObject *co)
+{
+    return 0;
+}
+
+void
+_PyJIT_Free(struct _PyJITCode *jit)
+{
+    Py_UNREACHABLE();
+}
+
+_PyJITResult
+_PyJIT_Enter(PyFrameObject *f, PyObject **stack_pointer,
+             PyThreadState *tstate, _PyJITFunction entry)
+{
+    Py_UNREACHABLE();
+}
+
+#endif /* JIT_SUPPORTED */
+
+
+/* Helpers called by the stencils.  They follow the corresponding
+   instructions of ceval.c. */
+
+_PyJITResult
+_PyJIT_DecrefAndGoto(PyObject *op, PyFrameObject *f, PyObject **stack_pointer,
+                     PyThreadState *tstate, _PyJITFunction next)
+{
+    Py_DECREF(op);
+    return next(f, stack_pointer, tstate);
+}
+
+/* Return a new reference, or NULL without an exception to let the
+   interpreter raise the NameError. */
+PyObject *
+_PyJIT_LoadGlobal(PyFrameObject *f, _PyJITLoadGlobal *cache)
+{
+    /* The machine code only runs with exact dicts */
+    PyDictObject *globals = (PyDictObject *)f->f_globals;
+    PyDictObject *builtins = (PyDictObject *)f->f_builtins;
+    assert(PyDict_CheckExact(globals) && PyDict_CheckExact(builtins));
+    PyObject *value = _PyDict_LoadGlobal(globals, builtins, cache->name);
+    if (value == NULL) {
+        return NULL;
+    }
+    cache->ptr = value;
+    cache->globals_ver = globals->ma_version_tag;
+    cache->builtins_ver = builtins->ma_version_tag;
+    Py_INCREF(value);
+    return value;
+}
+
+/* Return a new reference, or NULL with an exception set.  The cache
+   remembers where the attribute was found like the opcache of LOAD_ATTR
+   in ceval.c: in a slot (hint < -1) or in the instance dict, at index
+   hint, when the type has no attribute of that name. */
+PyObject *
+_PyJIT_LoadAttr(PyObject *owner, _PyJITLoadAttr *cache)
+{
+    PyTypeObject *type = Py_TYPE(owner);
+    _PyOpCodeOpt_LoadAttr *la = &cache->la;
+    PyObject *name = cache->name;
+    PyObject *res;
+
+    if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG) ||
+        type->tp_getattro != PyObject_GenericGetAttr)
+    {
+        return PyObject_GetAttr(owner, name);
+    }
+    if (la->type == type && la->tp_version_tag == type->tp_version_tag) {
+        if (la->hint < -1) {
+            res = *(PyObject **)((char *)owner + ~la->hint);
+            if (res != NULL) {
+                Py_INCREF(res);
+                return res;
+            }
+            /* Let PyObject_GetAttr() raise the AttributeError */
+            return PyObject_GetAttr(owner, name);
+        }
+        PyObject *dict = *(PyObject **)((char *)owner + type->tp_dictoffset);
+        if (dict != NULL && PyDict_CheckExact(dict)) {
+            res = NULL;
+            Py_INCREF(dict);
+            la->hint = _PyDict_GetItemHint((PyDictObject *)dict, name,
+                                           la->hint, &res);
+            Py_DECREF(dict);
+            if (res != NULL) {
+                Py_INCREF(res);
+                return res;
+            }
+            PyErr_Clear();
+        }
+        return PyObject_GetAttr(owner, name);
+    }
+
+    if (type->tp_dict == NULL && PyType_Ready(type) < 0) {
+        return NULL;
+    }
+    PyObject *descr = _PyType_Lookup(type, name);
+    if (descr != NULL) {
+        if (Py_IS_TYPE(descr, &PyMemberDescr_Type)) {
+            struct PyMemberDef *dmem = ((PyMemberDescrObject *)descr)->d_member;
+            if (dmem->type == T_OBJECT_EX) {
+                assert(dmem->offset > 0);
+                la->type = type;
+                la->tp_version_tag = type->tp_version_tag;
+                la->hint = ~dmem->offset;
+            }
+        }
+    }
+    else if (type->tp_dictoffset > 0) {
+        PyObject *dict = *(PyObject **)((char *)owner + type->tp_dictoffset);
+        if (dict != NULL && PyDict_CheckExact(dict)) {
+            res = NULL;
+            Py_INCREF(dict);
+            Py_ssize_t hint = _PyDict_GetItemHint((PyDictObject *)dict, name,
+                                                  -1, &res);
+            Py_DECREF(dict);
+            if (res != NULL) {
+                assert(hint >= 0);
+                la->type = type;
+                la->tp_version_tag = type->tp_version_tag;
+                la->hint = hint;
+                Py_INCREF(res);
+                return res;
+            }
+            PyErr_Clear();
+        }
+    }
+    return PyObject_GetAttr(owner, name);
+}
+
+/* Call the function under its oparg arguments (the last ones named by
+   kwnames) and release them all */
+PyObject *
+_PyJIT_CallFunction(PyThreadState *tstate, PyObject **stack_pointer,
+                    Py_ssize_t oparg, PyObject *kwnames)
+{
+    PyObject **pfunc = stack_pointer - oparg - 1;
+    PyObject *func = *pfunc;
+    Py_ssize_t nkwargs = (kwnames == NULL) ? 0 : PyTuple_GET_SIZE(kwnames);
+    PyObject *res = _PyObject_VectorcallTstate(
+        tstate, func, pfunc + 1,
+        (oparg - nkwargs) | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
+    while (stack_pointer > pfunc) {
+        PyObject *w = *--stack_pointer;
+        Py_DECREF(w);
+    }
+    Py_XDECREF(kwnames);
+    return res;
+}
+
+/* Steal the oparg items under stack_pointer, even on failure */
+PyObject *
+_PyJIT_BuildTuple(PyObject **stack_pointer, Py_ssize_t oparg)
+{
+    PyObject *tup = PyTuple_New(oparg);
+    if (tup == NULL) {
+        while (--oparg >= 0) {
+            Py_DECREF(stack_pointer[-oparg - 1]);
+        }
+        return NULL;
+    }
+    while (--oparg >= 0) {
+        PyTuple_SET_ITEM(tup, oparg, *--stack_pointer);
+    }
+    return tup;
+}
+
+PyObject *
+_PyJIT_BuildList(PyObject **stack_pointer, Py_ssize_t oparg)
+{
+    PyObject *list = PyList_New(oparg);
+    if (list == NULL) {
+        while (--oparg >= 0) {
+            Py_DECREF(stack_pointer[-oparg - 1]);
+        }
+        return NULL;
+    }
+    while (--oparg >= 0) {
+        PyList_SET_ITEM(list, oparg, *--stack_pointer);
+    }
+    return list;
+}
+
+/* Push the items of a tuple or list of oparg items in reverse order from
+   stack_pointer up and return 1, or return 0 for anything else */
+int
+_PyJIT_UnpackSequence(PyObject *seq, Py_ssize_t oparg,
+                      PyObject **stack_pointer)
+{
+    PyObject **items;
+    if (PyTuple_CheckExact(seq) && PyTuple_GET_SIZE(seq) == oparg) {
+        items = ((PyTupleObject *)seq)->ob_item;
+    }
+    else if (PyList_CheckExact(seq) && PyList_GET_SIZE(seq) == oparg) {
+        items = ((PyListObject *)seq)->ob_item;
+    }
+    else {
+        return 0;
+    }
+    while (oparg--) {
+        PyObject *item = items[oparg];
+        Py_INCREF(item);
+        *stack_pointer++ = item;
+    }
+    return 1;
+}
+
+/* Return the next item, or NULL with an exception set on error and
+   without one when the iterator is exhausted */
+PyObject *
+_PyJIT_IterNext(PyObject *iter)
+{
+    PyObject *next = (*Py_TYPE(iter)->tp_iternext)(iter);
+    if (next == NULL && PyErr_Occurred()) {
+        if (!PyErr_ExceptionMatches(PyExc_StopIteration)) {
+            return NULL;
+        }
+        PyErr_Clear();
+    }
+    return next;
+}
+
+/* Consume v; store_fast is the local the result is stored to, or -1 */
+PyObject *
+_PyJIT_UnicodeConcatenate(PyFrameObject *f, PyObject *v, PyObject *w,
+                          int store_fast)
+{
+    if (Py_REFCNT(v) == 2 && store_fast >= 0 &&
+        f->f_localsplus[store_fast] == v)
+    {
+        /* Drop the reference of the local, so that v can be resized in
+           place */
+        f->f_localsplus[store_fast] = NULL;
+        Py_DECREF(v);
+    }
+    PyObject *res = v;
+    PyUnicode_Append(&res, w);
+    return res;
+}
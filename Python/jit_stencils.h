@@ -0,0 +1,2576 @@
+/* Auto-generated by Tools/jit/build.py from Tools/jit/template.c */
+
+/* Values of _PyJIT_LAYOUT the stencils were compiled with */
+static const Py_ssize_t jit_layout[] = {
+    0, 16, 0, 8, 16, 200, 24, 16, 24, 24, 48, 40, 96, 352, 16, 48, 0, 68, 24,
+};
+
+/* C symbols referenced by the stencils */
+#define JIT_SYMBOLS(SYMBOL) \
+    SYMBOL(PyCell_Get) \
+    SYMBOL(PyCell_Set) \
+    SYMBOL(PyErr_Occurred) \
+    SYMBOL(PyFloat_FromDouble) \
+    SYMBOL(PyFloat_Type) \
+    SYMBOL(PyList_Append) \
+    SYMBOL(PyList_Type) \
+    SYMBOL(PyLong_Type) \
+    SYMBOL(PyNumber_Add) \
+    SYMBOL(PyNumber_And) \
+    SYMBOL(PyNumber_FloorDivide) \
+    SYMBOL(PyNumber_InPlaceAdd) \
+    SYMBOL(PyNumber_InPlaceAnd) \
+    SYMBOL(PyNumber_InPlaceFloorDivide) \
+    SYMBOL(PyNumber_InPlaceLshift) \
+    SYMBOL(PyNumber_InPlaceMatrixMultiply) \
+    SYMBOL(PyNumber_InPlaceMultiply) \
+    SYMBOL(PyNumber_InPlaceOr) \
+    SYMBOL(PyNumber_InPlacePower) \
+    SYMBOL(PyNumber_InPlaceRemainder) \
+    SYMBOL(PyNumber_InPlaceRshift) \
+    SYMBOL(PyNumber_InPlaceSubtract) \
+    SYMBOL(PyNumber_InPlaceTrueDivide) \
+    SYMBOL(PyNumber_InPlaceXor) \
+    SYMBOL(PyNumber_Invert) \
+    SYMBOL(PyNumber_Lshift) \
+    SYMBOL(PyNumber_MatrixMultiply) \
+    SYMBOL(PyNumber_Multiply) \
+    SYMBOL(PyNumber_Negative) \
+    SYMBOL(PyNumber_Or) \
+    SYMBOL(PyNumber_Positive) \
+    SYMBOL(PyNumber_Power) \
+    SYMBOL(PyNumber_Remainder) \
+    SYMBOL(PyNumber_Rshift) \
+    SYMBOL(PyNumber_Subtract) \
+    SYMBOL(PyNumber_TrueDivide) \
+    SYMBOL(PyNumber_Xor) \
+    SYMBOL(PyObject_DelItem) \
+    SYMBOL(PyObject_GetItem) \
+    SYMBOL(PyObject_GetIter) \
+    SYMBOL(PyObject_IsTrue) \
+    SYMBOL(PyObject_RichCompare) \
+    SYMBOL(PyObject_SetAttr) \
+    SYMBOL(PyObject_SetItem) \
+    SYMBOL(PySequence_Contains) \
+    SYMBOL(PySlice_New) \
+    SYMBOL(PyTuple_Type) \
+    SYMBOL(PyUnicode_Type) \
+    SYMBOL(_PyJIT_BuildList) \
+    SYMBOL(_PyJIT_BuildTuple) \
+    SYMBOL(_PyJIT_CallFunction) \
+    SYMBOL(_PyJIT_DecrefAndGoto) \
+    SYMBOL(_PyJIT_IterNext) \
+    SYMBOL(_PyJIT_LoadAttr) \
+    SYMBOL(_PyJIT_LoadGlobal) \
+    SYMBOL(_PyJIT_UnicodeConcatenate) \
+    SYMBOL(_PyJIT_UnpackSequence) \
+    SYMBOL(_PyLong_Add) \
+    SYMBOL(_PyLong_Subtract) \
+    SYMBOL(_PyObject_GetMethod) \
+    SYMBOL(_Py_Dealloc) \
+    SYMBOL(_Py_FalseStruct) \
+    SYMBOL(_Py_NoneStruct) \
+    SYMBOL(_Py_TrueStruct) \
+
+static const unsigned char jit_code_unsupported[] = {
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0xf0, 0x89, 0x57, 0x60, 0xba, 0x02, 0x00, 0x00, 0x00, 0xc3,
+};
+static const JITHole jit_holes_unsupported[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+};
+
+
+
+
+static const unsigned char jit_code_LOAD_FAST[] = {
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x63,
+    0xc9, 0x48, 0x8b, 0x8c, 0xcf, 0x60, 0x01, 0x00, 0x00, 0x48, 0x85, 0xc9,
+    0x74, 0x1e, 0x48, 0x83, 0x01, 0x01, 0x48, 0x83, 0xc6, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x4e, 0xf8,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xf0, 0x89, 0x57, 0x60,
+    0xba, 0x02, 0x00, 0x00, 0x00, 0xc3,
+};
+static const JITHole jit_holes_LOAD_FAST[] = {
+    {0x2, HOLE_OPARG, 0, 0},
+    {0x24, HOLE_CONTINUE, 0, 0},
+    {0x3a, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_LOAD_FAST_AND_CLEAR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xc6, 0x08, 0x48, 0x98, 0x48, 0x83, 0xc0, 0x2c, 0x48, 0x8b, 0x0c, 0xc7,
+    0x48, 0x89, 0x4e, 0xf8, 0x48, 0xc7, 0x04, 0xc7, 0x00, 0x00, 0x00, 0x00,
+};
+static const JITHole jit_holes_LOAD_FAST_AND_CLEAR[] = {
+    {0x2, HOLE_OPARG, 0, 0},
+};
+
+static const unsigned char jit_code_LOAD_CONST[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xc6, 0x08, 0x48, 0x83, 0x00, 0x01, 0x48, 0x89, 0x46, 0xf8,
+};
+static const JITHole jit_holes_LOAD_CONST[] = {
+    {0x2, HOLE_OPERAND, 0, 0},
+};
+
+static const unsigned char jit_code_STORE_FAST[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x4e, 0xf8, 0x4c, 0x8d, 0x4e, 0xf8, 0x89, 0x47, 0x60, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x98, 0x48, 0x83, 0xc0,
+    0x2c, 0x48, 0x8b, 0x1c, 0xc7, 0x48, 0x89, 0x0c, 0xc7, 0x48, 0x85, 0xdb,
+    0x74, 0x10, 0x48, 0x8b, 0x03, 0x48, 0x83, 0xf8, 0x01, 0x74, 0x1d, 0x48,
+    0x83, 0xe8, 0x01, 0x48, 0x89, 0x03, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xce, 0xff, 0xe0, 0x0f, 0x1f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xfe, 0x4c, 0x89, 0xca, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf,
+    0xff, 0xe0,
+};
+static const JITHole jit_holes_STORE_FAST[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x17, HOLE_OPARG, 0, 0},
+    {0x44, HOLE_CONTINUE, 0, 0},
+    {0x5a, HOLE_CONTINUE, 0, 0},
+    {0x6d, HOLE_SYMBOL, 51, 0},
+};
+
+static const unsigned char jit_code_LOAD_CLOSURE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xc6, 0x08, 0x48, 0x98, 0x48, 0x8b, 0x84, 0xc7, 0x60, 0x01, 0x00, 0x00,
+    0x48, 0x83, 0x00, 0x01, 0x48, 0x89, 0x46, 0xf8,
+};
+static const JITHole jit_holes_LOAD_CLOSURE[] = {
+    {0x2, HOLE_OPARG, 0, 0},
+};
+
+static const unsigned char jit_code_LOAD_DEREF[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf9, 0x48, 0x89, 0xf5, 0x48, 0x98, 0x48, 0x83, 0xec, 0x10, 0x48,
+    0x89, 0x54, 0x24, 0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x89, 0x57, 0x60, 0x48, 0x8b, 0xbc, 0xc7, 0x60, 0x01, 0x00,
+    0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x0c, 0x24, 0xff, 0xd0, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x85, 0xc0,
+    0x74, 0x26, 0x48, 0x89, 0x45, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48,
+    0x83, 0xc4, 0x10, 0x48, 0x89, 0xcf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x75, 0x08, 0x5d, 0xff, 0xe0, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0xe8, 0x89, 0x51, 0x60, 0x48, 0x83, 0xc4, 0x10,
+    0xba, 0x02, 0x00, 0x00, 0x00, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_LOAD_DEREF[] = {
+    {0x2, HOLE_OPARG, 0, 0},
+    {0x1e, HOLE_INDEX, 0, 0},
+    {0x33, HOLE_SYMBOL, 0, 0},
+    {0x5c, HOLE_CONTINUE, 0, 0},
+    {0x72, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_STORE_DEREF[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x10,
+    0x89, 0x47, 0x60, 0x48, 0x8d, 0x46, 0xf8, 0x48, 0x89, 0xde, 0x48, 0x89,
+    0x44, 0x24, 0x18, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x98, 0x48, 0x89, 0x5c, 0x24, 0x08, 0x48, 0x8b, 0xbc, 0xc7,
+    0x60, 0x01, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x08, 0x48, 0x8b, 0x54,
+    0x24, 0x10, 0x48, 0x83, 0x2b, 0x01, 0x74, 0x58, 0x48, 0x8b, 0x42, 0x30,
+    0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44,
+    0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x45, 0x60, 0x48, 0x8b, 0x44,
+    0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x5d, 0xc3, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x18, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x8b, 0x54, 0x24,
+    0x08, 0xeb, 0x8d,
+};
+static const JITHole jit_holes_STORE_DEREF[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x35, HOLE_OPARG, 0, 0},
+    {0x4e, HOLE_SYMBOL, 1, 0},
+    {0x74, HOLE_INDEX, 0, 0},
+    {0xae, HOLE_CONTINUE, 0, 0},
+    {0xca, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_LOAD_GLOBAL[] = {
+    0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x89, 0xf1, 0x48, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x83, 0xec, 0x10, 0x89, 0x5f, 0x60, 0x4c, 0x8b,
+    0x45, 0x28, 0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8b, 0x7f, 0x30, 0x48, 0x85, 0xc0, 0x74, 0x0a, 0x4c, 0x8b, 0x4e,
+    0x10, 0x4c, 0x39, 0x4f, 0x18, 0x74, 0x45, 0x48, 0x89, 0x54, 0x24, 0x08,
+    0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x0c, 0x24, 0xff, 0xd0, 0x48, 0x8b, 0x0c, 0x24, 0x48,
+    0x8b, 0x54, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x74, 0x37, 0x48, 0x89, 0x01,
+    0x48, 0x83, 0xc4, 0x10, 0x48, 0x89, 0xef, 0x48, 0x8d, 0x71, 0x08, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0x8b, 0x7e, 0x18, 0x49, 0x39, 0x78, 0x18,
+    0x75, 0xb1, 0x48, 0x83, 0x00, 0x01, 0xeb, 0xd1, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xd0, 0x48, 0x8b, 0x0c, 0x24, 0xba, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x85, 0xc0, 0x89, 0x5d, 0x60, 0x74, 0x09, 0x48, 0x83, 0xc4, 0x10, 0x48,
+    0x89, 0xc8, 0x5d, 0xc3, 0xba, 0x02, 0x00, 0x00, 0x00, 0xeb, 0xf0,
+};
+static const JITHole jit_holes_LOAD_GLOBAL[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x13, HOLE_OPERAND, 0, 0},
+    {0x28, HOLE_OPERAND, 0, 8},
+    {0x4d, HOLE_SYMBOL, 54, 0},
+    {0x79, HOLE_CONTINUE, 0, 0},
+    {0xa2, HOLE_SYMBOL, 2, 0},
+    {0xb7, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_POP_TOP[] = {
+    0x48, 0x8b, 0x5e, 0xf8, 0x4c, 0x8d, 0x4e, 0xf8, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x47, 0x60, 0x48, 0x8b, 0x03,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0x1a, 0x48, 0x83, 0xe8, 0x01, 0x4c, 0x89,
+    0xce, 0x48, 0x89, 0x03, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x49, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xfe,
+    0x4c, 0x89, 0xca, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0xdf, 0xff, 0xe0,
+};
+static const JITHole jit_holes_POP_TOP[] = {
+    {0xa, HOLE_INDEX, 0, 0},
+    {0x2a, HOLE_CONTINUE, 0, 0},
+    {0x3a, HOLE_CONTINUE, 0, 0},
+    {0x4d, HOLE_SYMBOL, 51, 0},
+};
+
+static const unsigned char jit_code_ROT_TWO[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x0f,
+    0x6f, 0x46, 0xf0, 0x66, 0x0f, 0xc6, 0xc0, 0x01, 0x0f, 0x11, 0x46, 0xf0,
+    0xff, 0xe0,
+};
+static const JITHole jit_holes_ROT_TWO[] = {
+    {0x2, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_ROT_THREE[] = {
+    0xf3, 0x0f, 0x7e, 0x46, 0xf8, 0x48, 0x8b, 0x46, 0xf0, 0x0f, 0x16, 0x46,
+    0xe8, 0x48, 0x89, 0x46, 0xf8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x11, 0x46, 0xe8, 0xff, 0xe0,
+};
+static const JITHole jit_holes_ROT_THREE[] = {
+    {0x13, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_ROT_FOUR[] = {
+    0xf3, 0x0f, 0x6f, 0x46, 0xe0, 0xf3, 0x0f, 0x6f, 0x4e, 0xf0, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x0f, 0x6f, 0x56,
+    0xf0, 0x66, 0x0f, 0xc6, 0xc8, 0x01, 0x0f, 0x11, 0x4e, 0xe0, 0x66, 0x0f,
+    0xc6, 0xc2, 0x01, 0x0f, 0x11, 0x46, 0xf0, 0xff, 0xe0,
+};
+static const JITHole jit_holes_ROT_FOUR[] = {
+    {0xc, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_DUP_TOP[] = {
+    0x48, 0x8b, 0x46, 0xf8, 0x48, 0x83, 0xc6, 0x08, 0x48, 0x83, 0x00, 0x01,
+    0x48, 0x89, 0x46, 0xf8,
+};
+
+static const unsigned char jit_code_DUP_TOP_TWO[] = {
+    0xf3, 0x0f, 0x6f, 0x46, 0xf0, 0x48, 0x83, 0xc6, 0x10, 0x0f, 0x12, 0xc8,
+    0x66, 0x48, 0x0f, 0x7e, 0xc0, 0x66, 0x48, 0x0f, 0x7e, 0xc9, 0x48, 0x83,
+    0x01, 0x01, 0x48, 0x83, 0x00, 0x01, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x46, 0xf0, 0xff, 0xe0,
+};
+static const JITHole jit_holes_DUP_TOP_TWO[] = {
+    {0x20, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_UNARY_POSITIVE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x18, 0x89, 0x47, 0x60, 0x48,
+    0x8b, 0x7e, 0xf8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48,
+    0x8b, 0x54, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x56, 0x48, 0x85,
+    0xc0, 0x74, 0x76, 0x48, 0x89, 0x46, 0xf8, 0x48, 0x8b, 0x42, 0x30, 0x8b,
+    0x00, 0x85, 0xc0, 0x74, 0x2b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+    0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0xff, 0xd1, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+    0x54, 0x24, 0x18, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x85, 0xc0, 0x75,
+    0x8a, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
+    0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24,
+    0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x46, 0xf8,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_UNARY_POSITIVE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x29, HOLE_SYMBOL, 30, 0},
+    {0x67, HOLE_INDEX, 0, 0},
+    {0x99, HOLE_CONTINUE, 0, 0},
+    {0xaa, HOLE_SYMBOL, 60, 0},
+    {0xcf, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_UNARY_NEGATIVE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x18, 0x89, 0x47, 0x60, 0x48,
+    0x8b, 0x7e, 0xf8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48,
+    0x8b, 0x54, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x56, 0x48, 0x85,
+    0xc0, 0x74, 0x76, 0x48, 0x89, 0x46, 0xf8, 0x48, 0x8b, 0x42, 0x30, 0x8b,
+    0x00, 0x85, 0xc0, 0x74, 0x2b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+    0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0xff, 0xd1, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+    0x54, 0x24, 0x18, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x85, 0xc0, 0x75,
+    0x8a, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
+    0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24,
+    0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x46, 0xf8,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_UNARY_NEGATIVE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x29, HOLE_SYMBOL, 28, 0},
+    {0x67, HOLE_INDEX, 0, 0},
+    {0x99, HOLE_CONTINUE, 0, 0},
+    {0xaa, HOLE_SYMBOL, 60, 0},
+    {0xcf, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_UNARY_INVERT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x18, 0x89, 0x47, 0x60, 0x48,
+    0x8b, 0x7e, 0xf8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48,
+    0x8b, 0x54, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x56, 0x48, 0x85,
+    0xc0, 0x74, 0x76, 0x48, 0x89, 0x46, 0xf8, 0x48, 0x8b, 0x42, 0x30, 0x8b,
+    0x00, 0x85, 0xc0, 0x74, 0x2b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+    0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0xff, 0xd1, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+    0x54, 0x24, 0x18, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x85, 0xc0, 0x75,
+    0x8a, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
+    0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24,
+    0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x46, 0xf8,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_UNARY_INVERT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x29, HOLE_SYMBOL, 24, 0},
+    {0x67, HOLE_INDEX, 0, 0},
+    {0x99, HOLE_CONTINUE, 0, 0},
+    {0xaa, HOLE_SYMBOL, 60, 0},
+    {0xcf, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_UNARY_NOT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0x74, 0x24, 0x10, 0x89, 0x47, 0x60, 0x48,
+    0x8b, 0x7e, 0xf8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48,
+    0x8b, 0x5c, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x7e, 0x85, 0xc0,
+    0x0f, 0x88, 0x9c, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x0f, 0x45, 0xc2, 0x48, 0x83, 0x00, 0x01, 0x48, 0x89,
+    0x46, 0xf8, 0x48, 0x8b, 0x43, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08,
+    0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xef, 0x48, 0x89, 0xda, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x8b, 0x44, 0x24, 0x08,
+    0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x85, 0xc0,
+    0x0f, 0x89, 0x64, 0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44,
+    0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x46, 0xf8, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_UNARY_NOT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x29, HOLE_SYMBOL, 40, 0},
+    {0x5c, HOLE_SYMBOL, 63, 0},
+    {0x66, HOLE_SYMBOL, 61, 0},
+    {0x86, HOLE_INDEX, 0, 0},
+    {0xbc, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xf8, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_POWER[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x14, 0x24,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x5c, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b,
+    0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83, 0x2f, 0x01,
+    0x74, 0x76, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x91, 0x00, 0x00, 0x00,
+    0x48, 0x85, 0xc0, 0x0f, 0x84, 0xaa, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45,
+    0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40,
+    0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2d, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48,
+    0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x7c, 0x24,
+    0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x85, 0x6f, 0xff, 0xff,
+    0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0xdf, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b, 0x44,
+    0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x56, 0xff, 0xff, 0xff, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b,
+    0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x45,
+    0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_POWER[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 31, 0},
+    {0x3e, HOLE_SYMBOL, 62, 0},
+    {0x8d, HOLE_INDEX, 0, 0},
+    {0xc7, HOLE_CONTINUE, 0, 0},
+    {0xda, HOLE_SYMBOL, 60, 0},
+    {0x107, HOLE_SYMBOL, 60, 0},
+    {0x121, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_POWER[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x14, 0x24,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x5c, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b,
+    0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83, 0x2f, 0x01,
+    0x74, 0x76, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x91, 0x00, 0x00, 0x00,
+    0x48, 0x85, 0xc0, 0x0f, 0x84, 0xaa, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45,
+    0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40,
+    0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2d, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48,
+    0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x7c, 0x24,
+    0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x85, 0x6f, 0xff, 0xff,
+    0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0xdf, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b, 0x44,
+    0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x56, 0xff, 0xff, 0xff, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b,
+    0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x45,
+    0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_POWER[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 18, 0},
+    {0x3e, HOLE_SYMBOL, 62, 0},
+    {0x8d, HOLE_INDEX, 0, 0},
+    {0xc7, HOLE_CONTINUE, 0, 0},
+    {0xda, HOLE_SYMBOL, 60, 0},
+    {0x107, HOLE_SYMBOL, 60, 0},
+    {0x121, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_ADD[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x10, 0x8b, 0x44, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e,
+    0xf0, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8b, 0x56, 0xf8, 0x48, 0x8b, 0x47,
+    0x08, 0x48, 0x39, 0xc8, 0x0f, 0x84, 0x5a, 0x01, 0x00, 0x00, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xc8, 0x0f,
+    0x84, 0x87, 0x01, 0x00, 0x00, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x39, 0xc8, 0x0f, 0x84, 0x84, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0xd6, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x10, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x83, 0x2f, 0x01, 0x0f, 0x84, 0xaf, 0x01, 0x00, 0x00, 0x48, 0x83, 0x2a,
+    0x01, 0x0f, 0x84, 0xad, 0x00, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84,
+    0xc6, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24,
+    0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0,
+    0x74, 0x6e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44,
+    0x24, 0x08, 0x8b, 0x1c, 0x24, 0x89, 0x58, 0x60, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x39, 0x42, 0x08, 0x0f, 0x85, 0x72, 0xff, 0xff, 0xff, 0x48, 0x89,
+    0x54, 0x24, 0x10, 0x48, 0x89, 0xfe, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x8b, 0x54,
+    0x24, 0x10, 0xe9, 0x72, 0xff, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x7c, 0x24,
+    0x08, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd7, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b, 0x44, 0x24,
+    0x10, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x3a, 0xff, 0xff, 0xff, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x8b, 0x1c,
+    0x24, 0x89, 0x58, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x45, 0xf0,
+    0x5d, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x39, 0x42, 0x08,
+    0x0f, 0x85, 0x9c, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48,
+    0x89, 0xd6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x7c, 0x24, 0x10, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x10,
+    0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x0f, 0x85, 0xc2,
+    0xfe, 0xff, 0xff, 0xeb, 0x4a, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x39, 0x42, 0x08, 0x0f, 0x85, 0x6f, 0xfe, 0xff, 0xff, 0xf2, 0x0f,
+    0x10, 0x47, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x58, 0x42, 0x10, 0x48,
+    0x89, 0x54, 0x24, 0x10, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48,
+    0x8b, 0x54, 0x24, 0x10, 0x48, 0x83, 0x2f, 0x01, 0x0f, 0x85, 0x7b, 0xfe,
+    0xff, 0xff, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0xb9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x10, 0xff, 0xd1,
+    0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x18, 0xe9, 0x56,
+    0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x10, 0xff,
+    0xd1, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x10, 0xe9,
+    0x31, 0xfe, 0xff, 0xff,
+};
+static const JITHole jit_holes_BINARY_ADD[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 7, 0},
+    {0x48, HOLE_SYMBOL, 4, 0},
+    {0x5b, HOLE_SYMBOL, 47, 0},
+    {0x76, HOLE_SYMBOL, 8, 0},
+    {0xc4, HOLE_INDEX, 0, 0},
+    {0x104, HOLE_OPARG, 0, 0},
+    {0x113, HOLE_SYMBOL, 55, 0},
+    {0x13f, HOLE_CONTINUE, 0, 0},
+    {0x15a, HOLE_SYMBOL, 60, 0},
+    {0x174, HOLE_INDEX, 0, 0},
+    {0x1b4, HOLE_SYMBOL, 57, 0},
+    {0x1f6, HOLE_SYMBOL, 3, 0},
+    {0x225, HOLE_SYMBOL, 60, 0},
+    {0x24a, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_INPLACE_ADD[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x10, 0x8b, 0x44, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e,
+    0xf0, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8b, 0x56, 0xf8, 0x48, 0x8b, 0x47,
+    0x08, 0x48, 0x39, 0xc8, 0x0f, 0x84, 0x5a, 0x01, 0x00, 0x00, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xc8, 0x0f,
+    0x84, 0x87, 0x01, 0x00, 0x00, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x39, 0xc8, 0x0f, 0x84, 0x84, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0xd6, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x10, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x83, 0x2f, 0x01, 0x0f, 0x84, 0xaf, 0x01, 0x00, 0x00, 0x48, 0x83, 0x2a,
+    0x01, 0x0f, 0x84, 0xad, 0x00, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84,
+    0xc6, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24,
+    0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0,
+    0x74, 0x6e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44,
+    0x24, 0x08, 0x8b, 0x1c, 0x24, 0x89, 0x58, 0x60, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x39, 0x42, 0x08, 0x0f, 0x85, 0x72, 0xff, 0xff, 0xff, 0x48, 0x89,
+    0x54, 0x24, 0x10, 0x48, 0x89, 0xfe, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x8b, 0x54,
+    0x24, 0x10, 0xe9, 0x72, 0xff, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x7c, 0x24,
+    0x08, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd7, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b, 0x44, 0x24,
+    0x10, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x3a, 0xff, 0xff, 0xff, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x8b, 0x1c,
+    0x24, 0x89, 0x58, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x45, 0xf0,
+    0x5d, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x39, 0x42, 0x08,
+    0x0f, 0x85, 0x9c, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48,
+    0x89, 0xd6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x7c, 0x24, 0x10, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x10,
+    0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x0f, 0x85, 0xc2,
+    0xfe, 0xff, 0xff, 0xeb, 0x4a, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x39, 0x42, 0x08, 0x0f, 0x85, 0x6f, 0xfe, 0xff, 0xff, 0xf2, 0x0f,
+    0x10, 0x47, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x58, 0x42, 0x10, 0x48,
+    0x89, 0x54, 0x24, 0x10, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48,
+    0x8b, 0x54, 0x24, 0x10, 0x48, 0x83, 0x2f, 0x01, 0x0f, 0x85, 0x7b, 0xfe,
+    0xff, 0xff, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0xb9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x10, 0xff, 0xd1,
+    0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x18, 0xe9, 0x56,
+    0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x10, 0xff,
+    0xd1, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x10, 0xe9,
+    0x31, 0xfe, 0xff, 0xff,
+};
+static const JITHole jit_holes_INPLACE_ADD[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 7, 0},
+    {0x48, HOLE_SYMBOL, 4, 0},
+    {0x5b, HOLE_SYMBOL, 47, 0},
+    {0x76, HOLE_SYMBOL, 11, 0},
+    {0xc4, HOLE_INDEX, 0, 0},
+    {0x104, HOLE_OPARG, 0, 0},
+    {0x113, HOLE_SYMBOL, 55, 0},
+    {0x13f, HOLE_CONTINUE, 0, 0},
+    {0x15a, HOLE_SYMBOL, 60, 0},
+    {0x174, HOLE_INDEX, 0, 0},
+    {0x1b4, HOLE_SYMBOL, 57, 0},
+    {0x1f6, HOLE_SYMBOL, 3, 0},
+    {0x225, HOLE_SYMBOL, 60, 0},
+    {0x24a, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_BINARY_SUBTRACT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24,
+    0x08, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e,
+    0xf0, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8b, 0x56, 0xf8, 0x48, 0x8b, 0x47,
+    0x08, 0x48, 0x39, 0xd8, 0x0f, 0x84, 0x72, 0x01, 0x00, 0x00, 0x48, 0xbb,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xd8, 0x0f,
+    0x84, 0xa7, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89,
+    0xd6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x8b, 0x7c, 0x24, 0x08, 0x48, 0x83, 0x2f, 0x01, 0x0f, 0x84, 0xba, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0x2a, 0x01, 0x0f, 0x84, 0xda, 0x00, 0x00, 0x00,
+    0x48, 0x85, 0xc0, 0x0f, 0x84, 0xf3, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45,
+    0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40,
+    0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x31, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x8b, 0x0c, 0x24, 0x89, 0x48,
+    0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x10, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x39, 0x42, 0x08, 0x0f, 0x85, 0x4f, 0xff,
+    0xff, 0xff, 0xf2, 0x0f, 0x10, 0x47, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x5c, 0x42, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b,
+    0x54, 0x24, 0x08, 0x48, 0x8b, 0x7c, 0x24, 0x18, 0xe9, 0x43, 0xff, 0xff,
+    0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbb, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48,
+    0x89, 0x44, 0x24, 0x08, 0xff, 0xd3, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2a, 0x01, 0x0f, 0x85, 0x26, 0xff,
+    0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd7, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x0d, 0xff, 0xff, 0xff,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10,
+    0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d,
+    0x45, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0x39, 0x42, 0x08,
+    0x0f, 0x85, 0x84, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48,
+    0x89, 0xd6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08,
+    0x48, 0x8b, 0x54, 0x24, 0x18, 0xe9, 0x92, 0xfe, 0xff, 0xff,
+};
+static const JITHole jit_holes_BINARY_SUBTRACT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 7, 0},
+    {0x48, HOLE_SYMBOL, 4, 0},
+    {0x63, HOLE_SYMBOL, 34, 0},
+    {0xb1, HOLE_INDEX, 0, 0},
+    {0xef, HOLE_CONTINUE, 0, 0},
+    {0x116, HOLE_SYMBOL, 3, 0},
+    {0x142, HOLE_SYMBOL, 60, 0},
+    {0x174, HOLE_SYMBOL, 60, 0},
+    {0x18e, HOLE_INDEX, 0, 0},
+    {0x1cc, HOLE_SYMBOL, 58, 0},
+};
+
+static const unsigned char jit_code_INPLACE_SUBTRACT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24,
+    0x08, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e,
+    0xf0, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8b, 0x56, 0xf8, 0x48, 0x8b, 0x47,
+    0x08, 0x48, 0x39, 0xd8, 0x0f, 0x84, 0x72, 0x01, 0x00, 0x00, 0x48, 0xbb,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xd8, 0x0f,
+    0x84, 0xa7, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89,
+    0xd6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x8b, 0x7c, 0x24, 0x08, 0x48, 0x83, 0x2f, 0x01, 0x0f, 0x84, 0xba, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0x2a, 0x01, 0x0f, 0x84, 0xda, 0x00, 0x00, 0x00,
+    0x48, 0x85, 0xc0, 0x0f, 0x84, 0xf3, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45,
+    0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40,
+    0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x31, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x8b, 0x0c, 0x24, 0x89, 0x48,
+    0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x10, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x39, 0x42, 0x08, 0x0f, 0x85, 0x4f, 0xff,
+    0xff, 0xff, 0xf2, 0x0f, 0x10, 0x47, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x5c, 0x42, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b,
+    0x54, 0x24, 0x08, 0x48, 0x8b, 0x7c, 0x24, 0x18, 0xe9, 0x43, 0xff, 0xff,
+    0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbb, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48,
+    0x89, 0x44, 0x24, 0x08, 0xff, 0xd3, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2a, 0x01, 0x0f, 0x85, 0x26, 0xff,
+    0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd7, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x0d, 0xff, 0xff, 0xff,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10,
+    0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d,
+    0x45, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0x39, 0x42, 0x08,
+    0x0f, 0x85, 0x84, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48,
+    0x89, 0xd6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08,
+    0x48, 0x8b, 0x54, 0x24, 0x18, 0xe9, 0x92, 0xfe, 0xff, 0xff,
+};
+static const JITHole jit_holes_INPLACE_SUBTRACT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 7, 0},
+    {0x48, HOLE_SYMBOL, 4, 0},
+    {0x63, HOLE_SYMBOL, 21, 0},
+    {0xb1, HOLE_INDEX, 0, 0},
+    {0xef, HOLE_CONTINUE, 0, 0},
+    {0x116, HOLE_SYMBOL, 3, 0},
+    {0x142, HOLE_SYMBOL, 60, 0},
+    {0x174, HOLE_SYMBOL, 60, 0},
+    {0x18e, HOLE_INDEX, 0, 0},
+    {0x1cc, HOLE_SYMBOL, 58, 0},
+};
+
+static const unsigned char jit_code_BINARY_SUBSCR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24,
+    0x08, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e,
+    0xf0, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8b, 0x56, 0xf8, 0x48, 0x8b, 0x47,
+    0x08, 0x48, 0x39, 0xd8, 0x0f, 0x84, 0x7a, 0x01, 0x00, 0x00, 0x48, 0xbb,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xd8, 0x0f,
+    0x84, 0xa7, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89,
+    0xd6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x8b, 0x7c, 0x24, 0x08, 0x48, 0x83, 0x2f, 0x01, 0x0f, 0x84, 0xc2, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0x2a, 0x01, 0x0f, 0x84, 0xe2, 0x00, 0x00, 0x00,
+    0x48, 0x85, 0xc0, 0x0f, 0x84, 0xfb, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45,
+    0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40,
+    0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x31, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x8b, 0x0c, 0x24, 0x89, 0x48,
+    0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x10, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x39, 0x42, 0x08, 0x0f, 0x85, 0x45, 0xff, 0xff, 0xff,
+    0x48, 0x8b, 0x5a, 0x10, 0x48, 0x8d, 0x43, 0x01, 0x48, 0x83, 0xf8, 0x02,
+    0x0f, 0x87, 0x33, 0xff, 0xff, 0xff, 0x8b, 0x72, 0x18, 0x48, 0x0f, 0xaf,
+    0xf3, 0x48, 0x3b, 0x77, 0x10, 0x0f, 0x83, 0x22, 0xff, 0xff, 0xff, 0x48,
+    0x8b, 0x44, 0xf7, 0x18, 0x48, 0x83, 0x00, 0x01, 0xe9, 0x37, 0xff, 0xff,
+    0xff, 0x0f, 0x1f, 0x00, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0x44, 0x24, 0x08,
+    0xff, 0xd3, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x08,
+    0x48, 0x83, 0x2a, 0x01, 0x0f, 0x85, 0x1e, 0xff, 0xff, 0xff, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0xd7, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+    0x85, 0xc0, 0x0f, 0x85, 0x05, 0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x8b, 0x0c, 0x24, 0x89,
+    0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x39, 0x5a, 0x08, 0x0f, 0x85, 0x85, 0xfe, 0xff, 0xff,
+    0x48, 0x8b, 0x5a, 0x10, 0x48, 0x8d, 0x73, 0x01, 0x48, 0x83, 0xfe, 0x02,
+    0x0f, 0x87, 0x73, 0xfe, 0xff, 0xff, 0x8b, 0x72, 0x18, 0x49, 0x89, 0xf0,
+    0x4c, 0x0f, 0xaf, 0xc3, 0x4c, 0x3b, 0x47, 0x10, 0x73, 0x1a, 0x48, 0x8b,
+    0x47, 0x18, 0x4a, 0x8b, 0x04, 0xc0, 0x48, 0x83, 0x00, 0x01, 0xe9, 0x75,
+    0xfe, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x39,
+    0xc0, 0x0f, 0x85, 0x36, 0xfe, 0xff, 0xff, 0xe9, 0x01, 0xff, 0xff, 0xff,
+};
+static const JITHole jit_holes_BINARY_SUBSCR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 6, 0},
+    {0x48, HOLE_SYMBOL, 46, 0},
+    {0x63, HOLE_SYMBOL, 38, 0},
+    {0xb1, HOLE_INDEX, 0, 0},
+    {0xef, HOLE_CONTINUE, 0, 0},
+    {0x102, HOLE_SYMBOL, 7, 0},
+    {0x14a, HOLE_SYMBOL, 60, 0},
+    {0x17c, HOLE_SYMBOL, 60, 0},
+    {0x196, HOLE_INDEX, 0, 0},
+    {0x1c2, HOLE_SYMBOL, 7, 0},
+    {0x212, HOLE_SYMBOL, 46, 0},
+};
+
+static const unsigned char jit_code_BINARY_MULTIPLY[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_MULTIPLY[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 27, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_MATRIX_MULTIPLY[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_MATRIX_MULTIPLY[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 26, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_TRUE_DIVIDE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_TRUE_DIVIDE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 35, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_FLOOR_DIVIDE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_FLOOR_DIVIDE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 10, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_MODULO[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_MODULO[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 32, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_LSHIFT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_LSHIFT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 25, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_RSHIFT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_RSHIFT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 33, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_AND[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_AND[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 9, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_XOR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_XOR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 36, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_BINARY_OR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BINARY_OR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 29, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_MULTIPLY[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_MULTIPLY[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 16, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_MATRIX_MULTIPLY[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_MATRIX_MULTIPLY[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 15, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_TRUE_DIVIDE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_TRUE_DIVIDE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 22, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_FLOOR_DIVIDE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_FLOOR_DIVIDE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 13, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_MODULO[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_MODULO[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 19, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_LSHIFT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_LSHIFT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 14, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_RSHIFT[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_RSHIFT[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 20, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_AND[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_AND[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 12, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_XOR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_XOR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 23, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_INPLACE_OR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x18,
+    0x89, 0x47, 0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x83,
+    0x2f, 0x01, 0x74, 0x78, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0x93, 0x00,
+    0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48,
+    0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24,
+    0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x85, 0x6d, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89,
+    0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x54,
+    0xff, 0xff, 0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_INPLACE_OR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 17, 0},
+    {0x83, HOLE_INDEX, 0, 0},
+    {0xbf, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_SYMBOL, 60, 0},
+    {0xff, HOLE_SYMBOL, 60, 0},
+    {0x119, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_STORE_SUBSCR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x30, 0x4c, 0x8b, 0x46, 0xf0, 0x4c, 0x8b,
+    0x4e, 0xe8, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x20, 0x48, 0x89, 0xde, 0x48,
+    0x89, 0x54, 0x24, 0x28, 0x4c, 0x89, 0xca, 0x89, 0x47, 0x60, 0x4c, 0x89,
+    0xc7, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c,
+    0x89, 0x4c, 0x24, 0x18, 0x48, 0x89, 0x5c, 0x24, 0x10, 0x4c, 0x89, 0x44,
+    0x24, 0x08, 0xff, 0xd0, 0x4c, 0x8b, 0x4c, 0x24, 0x18, 0x4c, 0x8b, 0x44,
+    0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x89, 0xc6, 0x49, 0x83, 0x29,
+    0x01, 0x0f, 0x84, 0xad, 0x00, 0x00, 0x00, 0x49, 0x83, 0x28, 0x01, 0x0f,
+    0x84, 0xd3, 0x00, 0x00, 0x00, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x84, 0xf4,
+    0x00, 0x00, 0x00, 0x48, 0x8d, 0x45, 0xe8, 0x85, 0xf6, 0x75, 0x61, 0x48,
+    0x8b, 0x4c, 0x24, 0x28, 0x48, 0x8b, 0x51, 0x30, 0x8b, 0x12, 0x85, 0xd2,
+    0x74, 0x2a, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 0x08, 0x48, 0x8b,
+    0x4c, 0x24, 0x20, 0x8b, 0x74, 0x24, 0x08, 0x89, 0x71, 0x60, 0x48, 0x83,
+    0xc4, 0x30, 0x5d, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0x8b, 0x54, 0x24,
+    0x28, 0x48, 0x8b, 0x7c, 0x24, 0x20, 0x48, 0x83, 0xc4, 0x30, 0x48, 0x89,
+    0xc6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0xff, 0xe0, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x4c, 0x24,
+    0x20, 0x8b, 0x5c, 0x24, 0x08, 0x89, 0x59, 0x60, 0x48, 0x83, 0xc4, 0x30,
+    0x5d, 0xc3, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4c, 0x89, 0x44, 0x24, 0x18, 0x4c, 0x89, 0xcf, 0x89, 0x44, 0x24, 0x08,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0,
+    0x4c, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x8b, 0x74,
+    0x24, 0x08, 0x49, 0x83, 0x28, 0x01, 0x0f, 0x85, 0x2d, 0xff, 0xff, 0xff,
+    0x48, 0x89, 0x5c, 0x24, 0x10, 0x4c, 0x89, 0xc7, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x74, 0x24, 0x08, 0xff, 0xd0,
+    0x48, 0x8b, 0x5c, 0x24, 0x10, 0x8b, 0x74, 0x24, 0x08, 0x48, 0x83, 0x2b,
+    0x01, 0x0f, 0x85, 0x0c, 0xff, 0xff, 0xff, 0x89, 0x74, 0x24, 0x08, 0x48,
+    0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x8b, 0x74, 0x24, 0x08, 0xe9, 0xf0, 0xfe, 0xff, 0xff,
+};
+static const JITHole jit_holes_STORE_SUBSCR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x3f, HOLE_SYMBOL, 43, 0},
+    {0xa0, HOLE_INDEX, 0, 0},
+    {0xdb, HOLE_CONTINUE, 0, 0},
+    {0xf2, HOLE_INDEX, 0, 0},
+    {0x12e, HOLE_SYMBOL, 60, 0},
+    {0x15a, HOLE_SYMBOL, 60, 0},
+    {0x184, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_DELETE_SUBSCR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x04, 0x24, 0x8b, 0x04, 0x24, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x89, 0x47,
+    0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0xde, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24, 0x08, 0x48,
+    0x89, 0x3c, 0x24, 0x48, 0x89, 0x54, 0x24, 0x18, 0xff, 0xd0, 0x48, 0x8b,
+    0x3c, 0x24, 0x48, 0x8b, 0x5c, 0x24, 0x08, 0x89, 0xc6, 0x48, 0x83, 0x2f,
+    0x01, 0x0f, 0x84, 0x8d, 0x00, 0x00, 0x00, 0x48, 0x83, 0x2b, 0x01, 0x0f,
+    0x84, 0xa4, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x45, 0xf0, 0x85, 0xf6, 0x75,
+    0x53, 0x48, 0x8b, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x51, 0x30, 0x8b, 0x12,
+    0x85, 0xd2, 0x74, 0x24, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x0c, 0x24, 0x48,
+    0x8b, 0x4c, 0x24, 0x10, 0x8b, 0x34, 0x24, 0x89, 0x71, 0x60, 0x48, 0x83,
+    0xc4, 0x20, 0x5d, 0xc3, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x7c,
+    0x24, 0x10, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xc6, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x0c, 0x24, 0x48, 0x8b, 0x4c, 0x24, 0x10,
+    0x8b, 0x1c, 0x24, 0x89, 0x59, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x40, 0x00, 0x89, 0x04, 0x24, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x08,
+    0x8b, 0x34, 0x24, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x85, 0x5c, 0xff, 0xff,
+    0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89,
+    0x34, 0x24, 0x48, 0x89, 0xdf, 0xff, 0xd0, 0x8b, 0x34, 0x24, 0xe9, 0x42,
+    0xff, 0xff, 0xff,
+};
+static const JITHole jit_holes_DELETE_SUBSCR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x2e, HOLE_SYMBOL, 37, 0},
+    {0x7e, HOLE_INDEX, 0, 0},
+    {0xb3, HOLE_CONTINUE, 0, 0},
+    {0xc2, HOLE_INDEX, 0, 0},
+    {0xed, HOLE_SYMBOL, 60, 0},
+    {0x10b, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_COMPARE_OP[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89, 0x44, 0x24,
+    0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x89, 0x47,
+    0x60, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8b, 0x73,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8b, 0x47, 0x08, 0x41, 0x89, 0xd1, 0x4c, 0x39, 0xc0, 0x0f, 0x84, 0xd1,
+    0x00, 0x00, 0x00, 0x48, 0x39, 0xf0, 0x75, 0x26, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xd0, 0x0f, 0x84, 0xd4,
+    0x00, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x39, 0xd0, 0x0f, 0x84, 0xc1, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x5c, 0x24, 0x18, 0x48, 0x89, 0xde, 0x44, 0x89, 0xca, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08,
+    0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48, 0x8b, 0x7c, 0x24, 0x08,
+    0x48, 0x83, 0x2f, 0x01, 0x0f, 0x84, 0xbb, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0x2b, 0x01, 0x0f, 0x84, 0xdb, 0x00, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f,
+    0x84, 0xf4, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45, 0xf0, 0x48, 0x8b, 0x04,
+    0x24, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40, 0x30, 0x8b, 0x00, 0x85,
+    0xc0, 0x74, 0x2d, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b,
+    0x44, 0x24, 0x10, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x7c, 0x24, 0x10, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x4c, 0x8b, 0x47, 0x10,
+    0x4d, 0x8d, 0x50, 0x01, 0x49, 0x83, 0xfa, 0x02, 0x0f, 0x86, 0xae, 0x00,
+    0x00, 0x00, 0x48, 0x39, 0xc6, 0x0f, 0x85, 0x3f, 0xff, 0xff, 0xff, 0x48,
+    0x89, 0x5c, 0x24, 0x18, 0x48, 0x89, 0xde, 0x44, 0x89, 0xca, 0x48, 0x89,
+    0x7c, 0x24, 0x08, 0xff, 0x90, 0xc8, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c,
+    0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x0f,
+    0x85, 0x45, 0xff, 0xff, 0xff, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24, 0x18, 0x48, 0x89, 0x44, 0x24,
+    0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24,
+    0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x85, 0x25, 0xff, 0xff, 0xff, 0x48,
+    0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0xdf, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b, 0x44, 0x24, 0x08,
+    0x48, 0x85, 0xc0, 0x0f, 0x85, 0x0c, 0xff, 0xff, 0xff, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x8b, 0x0c, 0x24,
+    0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x45, 0xf0, 0x5d,
+    0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xc6, 0x0f,
+    0x85, 0x91, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x73, 0x10, 0x4c, 0x8d, 0x56,
+    0x01, 0x49, 0x83, 0xfa, 0x02, 0x0f, 0x87, 0x40, 0xff, 0xff, 0xff, 0x8b,
+    0x47, 0x18, 0x4c, 0x0f, 0xaf, 0xc0, 0x8b, 0x43, 0x18, 0x48, 0x0f, 0xaf,
+    0xc6, 0x83, 0xfa, 0x02, 0x74, 0x4f, 0x7f, 0x38, 0x85, 0xd2, 0x74, 0x7c,
+    0x83, 0xfa, 0x01, 0x75, 0x5a, 0x49, 0x39, 0xc0, 0x0f, 0x9e, 0xc0, 0x0f,
+    0xb6, 0xc0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x85, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x0f, 0x45, 0xc2, 0x48, 0x83, 0x00, 0x01, 0xe9, 0x5b, 0xfe, 0xff,
+    0xff, 0x0f, 0x1f, 0x00, 0x83, 0xfa, 0x03, 0x74, 0x1b, 0x83, 0xfa, 0x04,
+    0x75, 0x21, 0x49, 0x39, 0xc0, 0x0f, 0x9f, 0xc0, 0x0f, 0xb6, 0xc0, 0xeb,
+    0xc5, 0x49, 0x39, 0xc0, 0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0, 0xeb, 0xba,
+    0x49, 0x39, 0xc0, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0xeb, 0xaf, 0x48,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x39, 0xc0,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0f,
+    0x4d, 0xc2, 0xeb, 0xac, 0x49, 0x39, 0xc0, 0x0f, 0x9c, 0xc0, 0x0f, 0xb6,
+    0xc0, 0xeb, 0x87,
+};
+static const JITHole jit_holes_COMPARE_OP[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 7, 0},
+    {0x3f, HOLE_OPARG, 0, 0},
+    {0x5e, HOLE_SYMBOL, 4, 0},
+    {0x71, HOLE_SYMBOL, 47, 0},
+    {0x8f, HOLE_SYMBOL, 41, 0},
+    {0xdd, HOLE_INDEX, 0, 0},
+    {0x117, HOLE_CONTINUE, 0, 0},
+    {0x16f, HOLE_SYMBOL, 60, 0},
+    {0x1a1, HOLE_SYMBOL, 60, 0},
+    {0x1bb, HOLE_INDEX, 0, 0},
+    {0x22c, HOLE_SYMBOL, 63, 0},
+    {0x238, HOLE_SYMBOL, 61, 0},
+    {0x27d, HOLE_SYMBOL, 63, 0},
+    {0x28a, HOLE_SYMBOL, 61, 0},
+};
+
+static const unsigned char jit_code_IS_OP[] = {
+    0x55, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xfd, 0x48, 0x8d, 0x5e, 0xf8, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xec,
+    0x20, 0x89, 0x47, 0x60, 0x48, 0x8b, 0x56, 0xf8, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7e, 0xf0, 0x48, 0x39,
+    0xd7, 0x0f, 0x84, 0xa1, 0x00, 0x00, 0x00, 0x49, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x0f, 0x45, 0xc0, 0x48, 0x83, 0x00,
+    0x01, 0x48, 0x89, 0x46, 0xf0, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x21, 0x48,
+    0x83, 0x2a, 0x01, 0x74, 0x4b, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xef,
+    0x48, 0x89, 0xca, 0x48, 0x89, 0xde, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x90, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 0x18, 0x48,
+    0x89, 0x5c, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0xff, 0xd0, 0x48,
+    0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0x83, 0x2a, 0x01, 0x75, 0xb5, 0x48, 0x89, 0x4c, 0x24,
+    0x10, 0x48, 0x89, 0xd7, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x5c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x4c,
+    0x24, 0x10, 0x48, 0x8b, 0x5c, 0x24, 0x08, 0xeb, 0x90, 0x0f, 0x1f, 0x00,
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf8,
+    0x01, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x0f, 0x45, 0xc0, 0xe9, 0x59, 0xff, 0xff, 0xff,
+};
+static const JITHole jit_holes_IS_OP[] = {
+    {0xd, HOLE_INDEX, 0, 0},
+    {0x22, HOLE_OPARG, 0, 0},
+    {0x39, HOLE_SYMBOL, 63, 0},
+    {0x45, HOLE_SYMBOL, 61, 0},
+    {0x74, HOLE_CONTINUE, 0, 0},
+    {0x82, HOLE_SYMBOL, 60, 0},
+    {0xba, HOLE_SYMBOL, 60, 0},
+    {0xda, HOLE_SYMBOL, 63, 0},
+    {0xe7, HOLE_SYMBOL, 61, 0},
+};
+
+static const unsigned char jit_code_CONTAINS_OP[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x8b,
+    0x76, 0xf0, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48,
+    0x89, 0x7c, 0x24, 0x18, 0x89, 0x47, 0x60, 0x48, 0x89, 0xdf, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x74, 0x24,
+    0x10, 0x48, 0x89, 0x5c, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x8b, 0x5c, 0x24, 0x08, 0x48, 0x83,
+    0x2e, 0x01, 0x0f, 0x84, 0x9c, 0x00, 0x00, 0x00, 0x48, 0x83, 0x2b, 0x01,
+    0x0f, 0x84, 0xbd, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x88, 0xd4, 0x00,
+    0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x75, 0xf8, 0x39, 0xd0, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x0f, 0x45, 0xd0, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b,
+    0x40, 0x30, 0x48, 0x83, 0x02, 0x01, 0x48, 0x89, 0x55, 0xf0, 0x8b, 0x00,
+    0x85, 0xc0, 0x74, 0x2c, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x24, 0x48,
+    0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c, 0x24, 0x89, 0x48, 0x60, 0x48, 0x83,
+    0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x7c, 0x24, 0x18, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x10, 0x48, 0x89, 0xf7, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x89, 0x44, 0x24, 0x08, 0xff, 0xd2, 0x48, 0x8b, 0x5c, 0x24,
+    0x10, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x85, 0x43,
+    0xff, 0xff, 0xff, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0xdf, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x8b, 0x44,
+    0x24, 0x08, 0x85, 0xc0, 0x0f, 0x89, 0x2c, 0xff, 0xff, 0xff, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x0c,
+    0x24, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x45, 0xf0,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_CONTAINS_OP[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x30, HOLE_SYMBOL, 44, 0},
+    {0x70, HOLE_OPARG, 0, 0},
+    {0x80, HOLE_SYMBOL, 63, 0},
+    {0x8a, HOLE_SYMBOL, 61, 0},
+    {0xae, HOLE_INDEX, 0, 0},
+    {0xe7, HOLE_CONTINUE, 0, 0},
+    {0x102, HOLE_SYMBOL, 60, 0},
+    {0x12c, HOLE_SYMBOL, 60, 0},
+    {0x144, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_LOAD_ATTR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x18, 0x89, 0x47, 0x60, 0x48,
+    0x8b, 0x7e, 0xf8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0xbe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48,
+    0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x8b, 0x54,
+    0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x54, 0x48, 0x85, 0xc0, 0x74,
+    0x74, 0x48, 0x89, 0x41, 0xf8, 0x48, 0x8b, 0x42, 0x30, 0x8b, 0x00, 0x85,
+    0xc0, 0x74, 0x29, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89,
+    0xc8, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xef, 0x48, 0x89, 0xce, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x90, 0x48, 0xbb, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0xff,
+    0xd3, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+    0x8b, 0x4c, 0x24, 0x10, 0x48, 0x85, 0xc0, 0x75, 0x8c, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x45, 0x60,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x41, 0xf8, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_LOAD_ATTR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x29, HOLE_SYMBOL, 53, 0},
+    {0x38, HOLE_OPERAND, 0, 0},
+    {0x71, HOLE_INDEX, 0, 0},
+    {0xa4, HOLE_CONTINUE, 0, 0},
+    {0xb2, HOLE_SYMBOL, 60, 0},
+    {0xd7, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_STORE_ATTR[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x4c, 0x8b,
+    0x46, 0xf0, 0x48, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x04, 0x24, 0x8b, 0x04, 0x24, 0x48, 0x89, 0x7c, 0x24, 0x10,
+    0x89, 0x47, 0x60, 0x48, 0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x4c, 0x89, 0xc2,
+    0x4c, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0x1c, 0x24, 0xff, 0xd0, 0x4c,
+    0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x1c, 0x24, 0x89, 0xc6, 0x49, 0x83,
+    0x28, 0x01, 0x0f, 0x84, 0x90, 0x00, 0x00, 0x00, 0x48, 0x83, 0x2b, 0x01,
+    0x0f, 0x84, 0xaf, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x45, 0xf0, 0x85, 0xf6,
+    0x75, 0x56, 0x48, 0x8b, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x51, 0x30, 0x8b,
+    0x12, 0x85, 0xd2, 0x74, 0x27, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x0c, 0x24,
+    0x48, 0x8b, 0x4c, 0x24, 0x10, 0x8b, 0x1c, 0x24, 0x89, 0x59, 0x60, 0x48,
+    0x83, 0xc4, 0x20, 0x5d, 0xc3, 0x0f, 0x1f, 0x00, 0x48, 0x8b, 0x54, 0x24,
+    0x18, 0x48, 0x8b, 0x7c, 0x24, 0x10, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89,
+    0xc6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0xff, 0xe0, 0x66, 0x90, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x0c, 0x24, 0x48,
+    0x8b, 0x4c, 0x24, 0x10, 0x8b, 0x1c, 0x24, 0x89, 0x59, 0x60, 0x48, 0x83,
+    0xc4, 0x20, 0x5d, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0x89, 0x5c, 0x24,
+    0x08, 0x4c, 0x89, 0xc7, 0x89, 0x04, 0x24, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x08,
+    0x8b, 0x34, 0x24, 0x48, 0x83, 0x2b, 0x01, 0x0f, 0x85, 0x51, 0xff, 0xff,
+    0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89,
+    0x34, 0x24, 0x48, 0x89, 0xdf, 0xff, 0xd0, 0x8b, 0x34, 0x24, 0xe9, 0x37,
+    0xff, 0xff, 0xff,
+};
+static const JITHole jit_holes_STORE_ATTR[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x1c, HOLE_OPERAND, 0, 0},
+    {0x38, HOLE_SYMBOL, 42, 0},
+    {0x8b, HOLE_INDEX, 0, 0},
+    {0xc3, HOLE_CONTINUE, 0, 0},
+    {0xd2, HOLE_INDEX, 0, 0},
+    {0x105, HOLE_SYMBOL, 60, 0},
+    {0x123, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_LOAD_METHOD[] = {
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x44, 0x89, 0x47, 0x60, 0x48, 0x89, 0x7c, 0x24,
+    0x08, 0x48, 0x8b, 0x7e, 0xf8, 0x48, 0x89, 0x54, 0x24, 0x10, 0x48, 0x89,
+    0xf2, 0x48, 0xc7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x3c, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x55, 0x00, 0x48, 0x8b, 0x3c, 0x24, 0x49, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48,
+    0x8b, 0x5c, 0x24, 0x10, 0x48, 0x85, 0xd2, 0x0f, 0x84, 0xb3, 0x00, 0x00,
+    0x00, 0x48, 0x8d, 0x75, 0x08, 0x85, 0xc0, 0x74, 0x4b, 0x48, 0x89, 0x55,
+    0xf8, 0x48, 0x8b, 0x43, 0x30, 0x48, 0x89, 0x7d, 0x00, 0x8b, 0x00, 0x85,
+    0xc0, 0x74, 0x19, 0x44, 0x89, 0x41, 0x60, 0x48, 0x89, 0xf0, 0xba, 0x03,
+    0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x5d, 0xc3, 0x0f, 0x1f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xda, 0x48,
+    0x89, 0xcf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xc7, 0x45, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0x2f, 0x01,
+    0x74, 0x0a, 0x48, 0x89, 0xd7, 0xeb, 0xa6, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0x89, 0x5c, 0x24, 0x18, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 0x10, 0x48, 0x89, 0x74, 0x24,
+    0x08, 0x48, 0x89, 0x14, 0x24, 0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x18,
+    0x48, 0x8b, 0x4c, 0x24, 0x10, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x48, 0x8b, 0x14, 0x24,
+    0xeb, 0xb8, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xed, 0x08, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x16, 0x44, 0x89,
+    0x41, 0x60, 0x48, 0x89, 0xe8, 0xba, 0x01, 0x00, 0x00, 0x00, 0xe9, 0x58,
+    0xff, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x0c, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x0c, 0x24, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xeb, 0xca,
+};
+static const JITHole jit_holes_LOAD_METHOD[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 59, 0},
+    {0x3a, HOLE_OPERAND, 0, 0},
+    {0x52, HOLE_INDEX, 0, 0},
+    {0xac, HOLE_CONTINUE, 0, 0},
+    {0xdf, HOLE_SYMBOL, 60, 0},
+    {0x103, HOLE_INDEX, 0, 0},
+    {0x142, HOLE_SYMBOL, 60, 0},
+    {0x156, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_CALL_METHOD[] = {
+    0x55, 0xb8, 0xfe, 0xff, 0xff, 0xff, 0x48, 0x89, 0xfb, 0x48, 0xbd, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xe8, 0x48, 0x89, 0xd7, 0x48, 0x98,
+    0x48, 0x83, 0xec, 0x20, 0x48, 0x83, 0x3c, 0xc6, 0x00, 0x44, 0x89, 0x43,
+    0x60, 0x48, 0x89, 0x5c, 0x24, 0x18, 0x0f, 0x84, 0xa4, 0x00, 0x00, 0x00,
+    0x8d, 0x55, 0x01, 0x48, 0x89, 0x74, 0x24, 0x10, 0x31, 0xc9, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24,
+    0x08, 0x48, 0x63, 0xd2, 0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48,
+    0x8b, 0x74, 0x24, 0x10, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x83, 0xc5, 0x02, 0x48, 0x63,
+    0xed, 0x48, 0xc1, 0xe5, 0x03, 0x48, 0x29, 0xee, 0x48, 0x85, 0xc0, 0x0f,
+    0x84, 0xb7, 0x00, 0x00, 0x00, 0x48, 0x89, 0x06, 0x48, 0x8b, 0x47, 0x30,
+    0x48, 0x8d, 0x4e, 0x08, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x16, 0x44, 0x89,
+    0x43, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xc8, 0xba, 0x03, 0x00,
+    0x00, 0x00, 0x5d, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0x8b, 0x47, 0x10,
+    0x8b, 0x40, 0x44, 0x85, 0xc0, 0x74, 0x65, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x00, 0x89, 0x43,
+    0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xc8, 0x5d, 0xc3, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x74, 0x24,
+    0x10, 0x48, 0x63, 0xd5, 0x31, 0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48,
+    0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x49, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x5c, 0x24, 0x18,
+    0xe9, 0x5a, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xfa, 0x48, 0x89, 0xce, 0x48, 0x89,
+    0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x44, 0x89, 0x43, 0x60,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0xba, 0x01, 0x00, 0x00, 0x00,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_CALL_METHOD[] = {
+    {0xb, HOLE_OPARG, 0, 0},
+    {0x15, HOLE_INDEX, 0, 0},
+    {0x48, HOLE_SYMBOL, 50, 0},
+    {0x66, HOLE_INDEX, 0, 0},
+    {0xbd, HOLE_NEXT_INDEX, 0, 0},
+    {0xec, HOLE_SYMBOL, 50, 0},
+    {0x107, HOLE_INDEX, 0, 0},
+    {0x12f, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_CALL_FUNCTION[] = {
+    0x49, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xd3, 0x31, 0xc9, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x63, 0xd5, 0x83, 0xc5, 0x01, 0x48, 0x83, 0xec, 0x20, 0x48, 0x63,
+    0xed, 0x44, 0x89, 0x4f, 0x60, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89,
+    0xdf, 0x48, 0xc1, 0xe5, 0x03, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89,
+    0x5c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x8b,
+    0x5c, 0x24, 0x08, 0x49, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4c, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x29, 0xee, 0x48, 0x85, 0xc0,
+    0x74, 0x72, 0x48, 0x89, 0x06, 0x48, 0x8b, 0x43, 0x30, 0x48, 0x8d, 0x4e,
+    0x08, 0x8b, 0x00, 0x85, 0xc0, 0x74, 0x19, 0x45, 0x89, 0x48, 0x60, 0x48,
+    0x83, 0xc4, 0x20, 0x48, 0x89, 0xc8, 0xba, 0x03, 0x00, 0x00, 0x00, 0x5d,
+    0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x10,
+    0x8b, 0x40, 0x44, 0x85, 0xc0, 0x74, 0x1d, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x00, 0x41, 0x89,
+    0x40, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xc8, 0x5d, 0xc3, 0x90,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xda, 0x48, 0x89, 0xce, 0x4c, 0x89,
+    0xc7, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x45, 0x89, 0x48, 0x60,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xf0, 0xba, 0x01, 0x00, 0x00, 0x00,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_CALL_FUNCTION[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x12, HOLE_OPARG, 0, 0},
+    {0x1c, HOLE_SYMBOL, 50, 0},
+    {0x59, HOLE_INDEX, 0, 0},
+    {0xa5, HOLE_NEXT_INDEX, 0, 0},
+    {0xcf, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_CALL_FUNCTION_KW[] = {
+    0x55, 0x49, 0x89, 0xf8, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0xd7, 0x48, 0x8d, 0x5e, 0xf8, 0x48, 0x63, 0xd5,
+    0x83, 0xc5, 0x01, 0x49, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x63, 0xed, 0x48, 0x83, 0xec, 0x20, 0x45, 0x89, 0x48, 0x60, 0x48, 0x8b,
+    0x4e, 0xf8, 0x48, 0x89, 0xde, 0x4c, 0x89, 0x44, 0x24, 0x18, 0x48, 0xc1,
+    0xe5, 0x03, 0x48, 0x89, 0x5c, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08,
+    0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0x8b, 0x7c, 0x24, 0x08,
+    0x49, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x8b,
+    0x44, 0x24, 0x18, 0x48, 0x29, 0xeb, 0x48, 0x85, 0xc0, 0x74, 0x79, 0x48,
+    0x89, 0x03, 0x48, 0x8b, 0x47, 0x30, 0x48, 0x8d, 0x73, 0x08, 0x8b, 0x00,
+    0x85, 0xc0, 0x74, 0x18, 0x45, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf0, 0xba, 0x03, 0x00, 0x00, 0x00, 0x5d, 0xc3, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x47, 0x10, 0x8b, 0x40, 0x44, 0x85,
+    0xc0, 0x74, 0x25, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xba, 0x02, 0x00, 0x00, 0x00, 0x41, 0x89, 0x40, 0x60, 0x48, 0x83,
+    0xc4, 0x20, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xfa, 0x4c,
+    0x89, 0xc7, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x45, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xd8, 0xba,
+    0x01, 0x00, 0x00, 0x00, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_CALL_FUNCTION_KW[] = {
+    {0x6, HOLE_OPARG, 0, 0},
+    {0x1d, HOLE_INDEX, 0, 0},
+    {0x27, HOLE_SYMBOL, 50, 0},
+    {0x62, HOLE_INDEX, 0, 0},
+    {0xad, HOLE_NEXT_INDEX, 0, 0},
+    {0xdc, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_BUILD_TUPLE[] = {
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x44, 0x89, 0x47, 0x60, 0x48, 0x89, 0x54, 0x24,
+    0x18, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x63, 0xd2, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x48, 0x89, 0xef, 0x48, 0x89,
+    0x54, 0x24, 0x08, 0x48, 0x89, 0xd6, 0xff, 0xd0, 0x48, 0x8b, 0x54, 0x24,
+    0x08, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48, 0xc1, 0xe2,
+    0x03, 0x48, 0x29, 0xd5, 0x48, 0x85, 0xc0, 0x74, 0x47, 0x48, 0x89, 0x45,
+    0x00, 0x48, 0x8b, 0x43, 0x30, 0x48, 0x8d, 0x75, 0x08, 0x8b, 0x00, 0x85,
+    0xc0, 0x74, 0x15, 0x44, 0x89, 0x41, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48,
+    0x89, 0xf0, 0xba, 0x03, 0x00, 0x00, 0x00, 0x5d, 0xc3, 0x0f, 0x1f, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xda, 0x48, 0x89, 0xcf, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x89, 0x41, 0x60,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xe8, 0xba, 0x01, 0x00, 0x00, 0x00,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_BUILD_TUPLE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 49, 0},
+    {0x27, HOLE_OPARG, 0, 0},
+    {0x50, HOLE_INDEX, 0, 0},
+    {0x9c, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_BUILD_LIST[] = {
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x44, 0x89, 0x47, 0x60, 0x48, 0x89, 0x54, 0x24,
+    0x18, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x63, 0xd2, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x48, 0x89, 0xef, 0x48, 0x89,
+    0x54, 0x24, 0x08, 0x48, 0x89, 0xd6, 0xff, 0xd0, 0x48, 0x8b, 0x54, 0x24,
+    0x08, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48, 0xc1, 0xe2,
+    0x03, 0x48, 0x29, 0xd5, 0x48, 0x85, 0xc0, 0x74, 0x47, 0x48, 0x89, 0x45,
+    0x00, 0x48, 0x8b, 0x43, 0x30, 0x48, 0x8d, 0x75, 0x08, 0x8b, 0x00, 0x85,
+    0xc0, 0x74, 0x15, 0x44, 0x89, 0x41, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48,
+    0x89, 0xf0, 0xba, 0x03, 0x00, 0x00, 0x00, 0x5d, 0xc3, 0x0f, 0x1f, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xda, 0x48, 0x89, 0xcf, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x89, 0x41, 0x60,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xe8, 0xba, 0x01, 0x00, 0x00, 0x00,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_BUILD_LIST[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 48, 0},
+    {0x27, HOLE_OPARG, 0, 0},
+    {0x50, HOLE_INDEX, 0, 0},
+    {0x9c, HOLE_CONTINUE, 0, 0},
+};
+
+static const unsigned char jit_code_BUILD_SLICE[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0x83, 0xec, 0x30, 0x48, 0x8b, 0x5e, 0xf8, 0x48, 0x89,
+    0x44, 0x24, 0x10, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x28,
+    0x89, 0x47, 0x60, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x54, 0x24, 0x08, 0x83, 0xf8, 0x03, 0x0f, 0x84, 0xc9,
+    0x00, 0x00, 0x00, 0x31, 0xdb, 0x48, 0x8b, 0x75, 0xf8, 0x48, 0x8b, 0x7d,
+    0xf0, 0x48, 0x89, 0x5c, 0x24, 0x20, 0x48, 0x89, 0xda, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x74, 0x24, 0x18,
+    0x48, 0x89, 0x7c, 0x24, 0x10, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x10,
+    0x48, 0x8b, 0x74, 0x24, 0x18, 0x48, 0x8b, 0x5c, 0x24, 0x20, 0x48, 0x83,
+    0x2f, 0x01, 0x0f, 0x84, 0xc0, 0x00, 0x00, 0x00, 0x48, 0x83, 0x2e, 0x01,
+    0x0f, 0x84, 0x8e, 0x00, 0x00, 0x00, 0x48, 0x85, 0xdb, 0x74, 0x0a, 0x48,
+    0x83, 0x2b, 0x01, 0x0f, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x48, 0x85, 0xc0,
+    0x0f, 0x84, 0xe8, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45, 0xf0, 0x48, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x8b, 0x40, 0x30, 0x8b,
+    0x00, 0x85, 0xc0, 0x74, 0x2f, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+    0x08, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x8b, 0x4c, 0x24, 0x08, 0x89, 0x48,
+    0x60, 0x48, 0x83, 0xc4, 0x30, 0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x7c,
+    0x24, 0x28, 0x48, 0x83, 0xc4, 0x30, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0x83, 0xed, 0x08, 0xe9, 0x30, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24, 0x18, 0x48, 0x89, 0xf7,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x44, 0x24, 0x10, 0xff, 0xd2, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x48, 0x8b,
+    0x44, 0x24, 0x10, 0xe9, 0x4a, 0xff, 0xff, 0xff, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x10, 0xff,
+    0xd2, 0x48, 0x8b, 0x5c, 0x24, 0x20, 0x48, 0x8b, 0x74, 0x24, 0x18, 0x48,
+    0x8b, 0x44, 0x24, 0x10, 0xe9, 0x1b, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x00,
+    0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x89, 0xdf, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x48, 0x8b, 0x44, 0x24,
+    0x10, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x18, 0xff, 0xff, 0xff, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x8b,
+    0x4c, 0x24, 0x08, 0x89, 0x48, 0x60, 0x48, 0x83, 0xc4, 0x30, 0x48, 0x8d,
+    0x45, 0xf0, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_BUILD_SLICE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x29, HOLE_OPARG, 0, 0},
+    {0x53, HOLE_SYMBOL, 45, 0},
+    {0xbb, HOLE_INDEX, 0, 0},
+    {0xf8, HOLE_CONTINUE, 0, 0},
+    {0x122, HOLE_SYMBOL, 60, 0},
+    {0x142, HOLE_SYMBOL, 60, 0},
+    {0x172, HOLE_SYMBOL, 60, 0},
+    {0x18c, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_LIST_APPEND[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x8d, 0x6e, 0xf8, 0x48, 0x83, 0xec, 0x20, 0x48, 0x8b, 0x5e, 0xf8, 0x48,
+    0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x7c, 0x24,
+    0x10, 0x48, 0x89, 0xde, 0x89, 0x47, 0x60, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xd8, 0x48, 0x89, 0x5c, 0x24, 0x08,
+    0x48, 0x98, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x7c, 0xc5, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0,
+    0x48, 0x8b, 0x5c, 0x24, 0x08, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x83,
+    0x2b, 0x01, 0x74, 0x4c, 0x85, 0xc0, 0x74, 0x28, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x41, 0x60, 0x48,
+    0x83, 0xc4, 0x20, 0x48, 0x89, 0xe8, 0x5d, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x89, 0xee, 0x48, 0x89, 0xcf, 0x48,
+    0x83, 0xc4, 0x20, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x89, 0x44, 0x24, 0x08,
+    0x48, 0x89, 0xdf, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xd2, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x8b, 0x44, 0x24, 0x08,
+    0xeb, 0x96,
+};
+static const JITHole jit_holes_LIST_APPEND[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x2d, HOLE_OPARG, 0, 0},
+    {0x4a, HOLE_SYMBOL, 5, 0},
+    {0x6a, HOLE_INDEX, 0, 0},
+    {0xa1, HOLE_CONTINUE, 0, 0},
+    {0xb9, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_UNPACK_SEQUENCE[] = {
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x44, 0x89, 0x47, 0x60, 0x48, 0x89, 0x54, 0x24,
+    0x18, 0x48, 0x8d, 0x56, 0xf8, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x48, 0x8b,
+    0x7e, 0xf8, 0x48, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x63, 0xf6, 0x48, 0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x3c, 0x24,
+    0xff, 0xd0, 0x48, 0x8b, 0x3c, 0x24, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x85,
+    0xc0, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x75, 0x24, 0x49, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xe8, 0xba, 0x02, 0x00,
+    0x00, 0x00, 0x44, 0x89, 0x43, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x5d, 0xc3,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0x2f, 0x01,
+    0x48, 0x8d, 0x6c, 0xf5, 0xf8, 0x74, 0x25, 0x48, 0x8b, 0x54, 0x24, 0x18,
+    0x48, 0x89, 0xee, 0x48, 0x89, 0xdf, 0x48, 0x83, 0xc4, 0x20, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x1c, 0x24, 0xff, 0xd0,
+    0x48, 0x8b, 0x1c, 0x24, 0xeb, 0xc5,
+};
+static const JITHole jit_holes_UNPACK_SEQUENCE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 56, 0},
+    {0x34, HOLE_OPARG, 0, 0},
+    {0x5e, HOLE_INDEX, 0, 0},
+    {0x9c, HOLE_CONTINUE, 0, 0},
+    {0xb2, HOLE_SYMBOL, 60, 0},
+};
+
+static const unsigned char jit_code_GET_ITER[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b,
+    0x44, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x18, 0x89, 0x47, 0x60, 0x48,
+    0x8b, 0x7e, 0xf8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48,
+    0x8b, 0x54, 0x24, 0x18, 0x48, 0x83, 0x2f, 0x01, 0x74, 0x56, 0x48, 0x85,
+    0xc0, 0x74, 0x76, 0x48, 0x89, 0x46, 0xf8, 0x48, 0x8b, 0x42, 0x30, 0x8b,
+    0x00, 0x85, 0xc0, 0x74, 0x2b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+    0x08, 0x8b, 0x44, 0x24, 0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf0, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x44, 0x24, 0x08, 0xff, 0xd1, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+    0x54, 0x24, 0x18, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x85, 0xc0, 0x75,
+    0x8a, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
+    0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8b, 0x44, 0x24,
+    0x08, 0x89, 0x45, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x8d, 0x46, 0xf8,
+    0x5d, 0xc3,
+};
+static const JITHole jit_holes_GET_ITER[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x29, HOLE_SYMBOL, 39, 0},
+    {0x67, HOLE_INDEX, 0, 0},
+    {0x99, HOLE_CONTINUE, 0, 0},
+    {0xaa, HOLE_SYMBOL, 60, 0},
+    {0xcf, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_FOR_ITER[] = {
+    0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xf5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xec, 0x20, 0x89, 0x5f, 0x60, 0x48, 0x89, 0x54, 0x24, 0x10,
+    0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x7e, 0xf8, 0xff, 0xd0, 0x48,
+    0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x85, 0xc0,
+    0x74, 0x4a, 0x48, 0x89, 0x45, 0x00, 0x48, 0x8b, 0x42, 0x30, 0x48, 0x8d,
+    0x75, 0x08, 0x8b, 0x18, 0x85, 0xdb, 0x74, 0x20, 0x48, 0xbb, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xf0, 0xba, 0x03, 0x00,
+    0x00, 0x00, 0x89, 0x59, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x5d, 0xc3, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xcf, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x10, 0x48, 0x89, 0x4c, 0x24, 0x08,
+    0xff, 0xd0, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x10,
+    0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x85,
+    0xc0, 0x74, 0x19, 0x89, 0x59, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89,
+    0xe8, 0xba, 0x01, 0x00, 0x00, 0x00, 0x5d, 0xc3, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7d, 0xf8, 0x48, 0x8d, 0x75, 0xf8,
+    0x48, 0x83, 0x2f, 0x01, 0x74, 0x3a, 0x48, 0x8b, 0x42, 0x30, 0x8b, 0x00,
+    0x85, 0xc0, 0x74, 0x18, 0x89, 0x59, 0x60, 0x48, 0x89, 0xf0, 0xba, 0x03,
+    0x00, 0x00, 0x00, 0xe9, 0x6d, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xcf, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0x4c, 0x24, 0x10,
+    0x48, 0x89, 0x74, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x54, 0x24, 0x18,
+    0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x08, 0xeb, 0x90,
+};
+static const JITHole jit_holes_FOR_ITER[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 52, 0},
+    {0x52, HOLE_INDEX, 0, 0},
+    {0x79, HOLE_CONTINUE, 0, 0},
+    {0x8a, HOLE_SYMBOL, 2, 0},
+    {0xaa, HOLE_INDEX, 0, 0},
+    {0x109, HOLE_TARGET, 0, 0},
+    {0x11a, HOLE_SYMBOL, 60, 0},
+    {0x13f, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_JUMP_FORWARD[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const JITHole jit_holes_JUMP_FORWARD[] = {
+    {0x2, HOLE_TARGET, 0, 0},
+};
+
+static const unsigned char jit_code_JUMP_ABSOLUTE[] = {
+    0x48, 0x8b, 0x42, 0x10, 0x8b, 0x40, 0x44, 0x85, 0xc0, 0x74, 0x1d, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x02, 0x00,
+    0x00, 0x00, 0x89, 0x47, 0x60, 0x48, 0x89, 0xf0, 0xc3, 0x0f, 0x1f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xe0,
+};
+static const JITHole jit_holes_JUMP_ABSOLUTE[] = {
+    {0xd, HOLE_INDEX, 0, 0},
+    {0x2a, HOLE_TARGET, 0, 0},
+};
+
+static const unsigned char jit_code_POP_JUMP_IF_FALSE[] = {
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x42, 0x10, 0x89, 0x4f, 0x60, 0x8b, 0x40, 0x44, 0x85, 0xc0, 0x0f, 0x85,
+    0xc4, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x48, 0x89, 0xfd, 0x48, 0x8d, 0x5e, 0xf8, 0x48, 0x83,
+    0xec, 0x20, 0x48, 0x8b, 0x7e, 0xf8, 0x48, 0x39, 0xc7, 0x74, 0x75, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xc7,
+    0x74, 0x3e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0x5c, 0x24, 0x10, 0x48, 0x89,
+    0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b,
+    0x5c, 0x24, 0x10, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x85, 0xc0, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x0f, 0x88, 0xa2, 0x00,
+    0x00, 0x00, 0x75, 0x28, 0x48, 0x8b, 0x07, 0x48, 0x83, 0xf8, 0x01, 0x74,
+    0x5f, 0x48, 0x83, 0xe8, 0x01, 0x48, 0x89, 0xde, 0x48, 0x89, 0x07, 0x48,
+    0x83, 0xc4, 0x20, 0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x90, 0x48, 0x8b, 0x07, 0x48,
+    0x83, 0xf8, 0x01, 0x74, 0x5f, 0x48, 0x83, 0xe8, 0x01, 0x48, 0x89, 0xde,
+    0x48, 0x89, 0x07, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xef, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xf0, 0xba,
+    0x02, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xc4, 0x20, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xee, 0x48, 0x89, 0xda, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xeb, 0xd6, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0x83, 0x2f, 0x01,
+    0x74, 0x12, 0x89, 0x4d, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xd8,
+    0xba, 0x01, 0x00, 0x00, 0x00, 0x5d, 0xc3, 0x90, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x5c, 0x24, 0x08, 0xff,
+    0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x08, 0x48, 0xb9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xeb, 0xcc,
+};
+static const JITHole jit_holes_POP_JUMP_IF_FALSE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x1e, HOLE_SYMBOL, 63, 0},
+    {0x3d, HOLE_SYMBOL, 61, 0},
+    {0x4c, HOLE_SYMBOL, 40, 0},
+    {0x71, HOLE_INDEX, 0, 0},
+    {0xa4, HOLE_TARGET, 0, 0},
+    {0xcc, HOLE_CONTINUE, 0, 0},
+    {0xf2, HOLE_TARGET, 0, 0},
+    {0x109, HOLE_SYMBOL, 51, 0},
+    {0x11a, HOLE_CONTINUE, 0, 0},
+    {0x142, HOLE_SYMBOL, 60, 0},
+    {0x158, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_POP_JUMP_IF_TRUE[] = {
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x42, 0x10, 0x89, 0x4f, 0x60, 0x8b, 0x40, 0x44, 0x85, 0xc0, 0x0f, 0x85,
+    0xd4, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x48, 0x89, 0xfd, 0x48, 0x8d, 0x5e, 0xf8, 0x48, 0x83,
+    0xec, 0x20, 0x48, 0x8b, 0x7e, 0xf8, 0x48, 0x39, 0xc7, 0x0f, 0x84, 0x81,
+    0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x39, 0xc7, 0x74, 0x41, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0x5c,
+    0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x7c,
+    0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48, 0xb9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x48, 0x8b, 0x54, 0x24, 0x18,
+    0x0f, 0x88, 0xae, 0x00, 0x00, 0x00, 0x83, 0xf8, 0x01, 0x74, 0x31, 0x48,
+    0x8b, 0x07, 0x48, 0x83, 0xf8, 0x01, 0x0f, 0x84, 0x8c, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xe8, 0x01, 0x48, 0x89, 0xde, 0x48, 0x89, 0x07, 0x48, 0x83,
+    0xc4, 0x20, 0x48, 0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0x8b, 0x07, 0x48, 0x83, 0xf8, 0x01, 0x74, 0x37, 0x48, 0x83, 0xe8,
+    0x01, 0x48, 0x89, 0xde, 0x48, 0x89, 0x07, 0x48, 0x83, 0xc4, 0x20, 0x48,
+    0x89, 0xef, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0xf0, 0xba, 0x02, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xee,
+    0x48, 0x89, 0xda, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x49, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xd6, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0x83, 0x2f, 0x01, 0x74, 0x12, 0x89, 0x4d, 0x60, 0x48, 0x83, 0xc4,
+    0x20, 0x48, 0x89, 0xd8, 0xba, 0x01, 0x00, 0x00, 0x00, 0x5d, 0xc3, 0x90,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0x5c, 0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x5c, 0x24, 0x08, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xcc,
+};
+static const JITHole jit_holes_POP_JUMP_IF_TRUE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x1e, HOLE_SYMBOL, 63, 0},
+    {0x41, HOLE_SYMBOL, 61, 0},
+    {0x50, HOLE_SYMBOL, 40, 0},
+    {0x75, HOLE_INDEX, 0, 0},
+    {0xaf, HOLE_CONTINUE, 0, 0},
+    {0xdc, HOLE_TARGET, 0, 0},
+    {0x102, HOLE_TARGET, 0, 0},
+    {0x119, HOLE_SYMBOL, 51, 0},
+    {0x12a, HOLE_CONTINUE, 0, 0},
+    {0x152, HOLE_SYMBOL, 60, 0},
+    {0x168, HOLE_INDEX, 0, 0},
+};
+
+static const unsigned char jit_code_JUMP_IF_FALSE_OR_POP[] = {
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfb, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x89, 0x4f, 0x60, 0x48, 0x8b,
+    0x7e, 0xf8, 0x48, 0x39, 0xc7, 0x74, 0x49, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xc7, 0x74, 0x66, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24,
+    0x18, 0x48, 0x89, 0x5c, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff,
+    0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c, 0x24, 0x10, 0x48,
+    0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x48,
+    0x8b, 0x54, 0x24, 0x18, 0x78, 0x4e, 0x74, 0x2c, 0x48, 0x8b, 0x07, 0x48,
+    0x8d, 0x75, 0xf8, 0x48, 0x83, 0xf8, 0x01, 0x74, 0x57, 0x48, 0x83, 0xe8,
+    0x01, 0x48, 0x89, 0x07, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xdf, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xee, 0x48,
+    0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x4b, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xe8, 0xba, 0x01,
+    0x00, 0x00, 0x00, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xf2, 0x49, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xde, 0x5d, 0xff, 0xe0,
+};
+static const JITHole jit_holes_JUMP_IF_FALSE_OR_POP[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+    {0x10, HOLE_SYMBOL, 63, 0},
+    {0x2d, HOLE_SYMBOL, 61, 0},
+    {0x3c, HOLE_SYMBOL, 40, 0},
+    {0x61, HOLE_INDEX, 0, 0},
+    {0x91, HOLE_CONTINUE, 0, 0},
+    {0xac, HOLE_TARGET, 0, 0},
+    {0xe4, HOLE_CONTINUE, 0, 0},
+    {0xee, HOLE_SYMBOL, 51, 0},
+};
+
+static const unsigned char jit_code_JUMP_IF_TRUE_OR_POP[] = {
+    0x55, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xfb, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0xf5, 0x48, 0x83, 0xec, 0x20, 0x89, 0x57,
+    0x60, 0x48, 0x8b, 0x7e, 0xf8, 0x48, 0x39, 0xc7, 0x74, 0x7a, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xc7, 0x74,
+    0x3d, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x4c, 0x24, 0x18, 0x48, 0x89, 0x5c, 0x24, 0x10, 0x48, 0x89, 0x7c,
+    0x24, 0x08, 0xff, 0xd0, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x5c,
+    0x24, 0x10, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x85, 0xc0, 0x48, 0x8b, 0x4c, 0x24, 0x18, 0x78, 0x7b, 0x83, 0xf8, 0x01,
+    0x74, 0x2e, 0x48, 0x8b, 0x07, 0x48, 0x8d, 0x75, 0xf8, 0x48, 0x83, 0xf8,
+    0x01, 0x74, 0x41, 0x48, 0x83, 0xe8, 0x01, 0x48, 0x89, 0xca, 0x48, 0x89,
+    0x07, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x00,
+    0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xee, 0x48, 0x89, 0xca, 0x48, 0x89,
+    0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20,
+    0x48, 0x89, 0xf2, 0x48, 0x89, 0xde, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x53, 0x60, 0x48, 0x83, 0xc4, 0x20, 0x48, 0x89, 0xe8, 0xba, 0x01,
+    0x00, 0x00, 0x00, 0x5d, 0xc3,
+};
+static const JITHole jit_holes_JUMP_IF_TRUE_OR_POP[] = {
+    {0x9, HOLE_INDEX, 0, 0},
+    {0x13, HOLE_SYMBOL, 63, 0},
+    {0x30, HOLE_SYMBOL, 61, 0},
+    {0x3f, HOLE_SYMBOL, 40, 0},
+    {0x64, HOLE_INDEX, 0, 0},
+    {0x9a, HOLE_CONTINUE, 0, 0},
+    {0xb7, HOLE_TARGET, 0, 0},
+    {0xd4, HOLE_CONTINUE, 0, 0},
+    {0xde, HOLE_SYMBOL, 51, 0},
+};
+
+static const unsigned char jit_code_RETURN_VALUE[] = {
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0xf0, 0x89, 0x57, 0x60, 0x31, 0xd2, 0xc3,
+};
+static const JITHole jit_holes_RETURN_VALUE[] = {
+    {0x2, HOLE_INDEX, 0, 0},
+};
+
+static const JITStencil jit_stencils[256] = {
+    [0] = {22, jit_code_unsupported, 1, jit_holes_unsupported},
+    [SETUP_FINALLY] = {0, (const unsigned char *)"", 0, NULL},
+    [POP_BLOCK] = {0, (const unsigned char *)"", 0, NULL},
+    [NOP] = {0, (const unsigned char *)"", 0, NULL},
+    [LOAD_FAST] = {78, jit_code_LOAD_FAST, 3, jit_holes_LOAD_FAST},
+    [LOAD_FAST_AND_CLEAR] = {36, jit_code_LOAD_FAST_AND_CLEAR, 1, jit_holes_LOAD_FAST_AND_CLEAR},
+    [LOAD_CONST] = {22, jit_code_LOAD_CONST, 1, jit_holes_LOAD_CONST},
+    [STORE_FAST] = {122, jit_code_STORE_FAST, 5, jit_holes_STORE_FAST},
+    [LOAD_CLOSURE] = {32, jit_code_LOAD_CLOSURE, 1, jit_holes_LOAD_CLOSURE},
+    [LOAD_DEREF] = {139, jit_code_LOAD_DEREF, 5, jit_holes_LOAD_DEREF},
+    [STORE_DEREF] = {219, jit_code_STORE_DEREF, 6, jit_holes_STORE_DEREF},
+    [LOAD_GLOBAL] = {215, jit_code_LOAD_GLOBAL, 7, jit_holes_LOAD_GLOBAL},
+    [POP_TOP] = {90, jit_code_POP_TOP, 4, jit_holes_POP_TOP},
+    [ROT_TWO] = {26, jit_code_ROT_TWO, 1, jit_holes_ROT_TWO},
+    [ROT_THREE] = {33, jit_code_ROT_THREE, 1, jit_holes_ROT_THREE},
+    [ROT_FOUR] = {45, jit_code_ROT_FOUR, 1, jit_holes_ROT_FOUR},
+    [DUP_TOP] = {16, jit_code_DUP_TOP, 0, NULL},
+    [DUP_TOP_TWO] = {46, jit_code_DUP_TOP_TWO, 1, jit_holes_DUP_TOP_TWO},
+    [UNARY_POSITIVE] = {242, jit_code_UNARY_POSITIVE, 6, jit_holes_UNARY_POSITIVE},
+    [UNARY_NEGATIVE] = {242, jit_code_UNARY_NEGATIVE, 6, jit_holes_UNARY_NEGATIVE},
+    [UNARY_INVERT] = {242, jit_code_UNARY_INVERT, 6, jit_holes_UNARY_INVERT},
+    [UNARY_NOT] = {283, jit_code_UNARY_NOT, 8, jit_holes_UNARY_NOT},
+    [BINARY_POWER] = {327, jit_code_BINARY_POWER, 8, jit_holes_BINARY_POWER},
+    [INPLACE_POWER] = {327, jit_code_INPLACE_POWER, 8, jit_holes_INPLACE_POWER},
+    [BINARY_ADD] = {616, jit_code_BINARY_ADD, 15, jit_holes_BINARY_ADD},
+    [INPLACE_ADD] = {616, jit_code_INPLACE_ADD, 15, jit_holes_INPLACE_ADD},
+    [BINARY_SUBTRACT] = {490, jit_code_BINARY_SUBTRACT, 11, jit_holes_BINARY_SUBTRACT},
+    [INPLACE_SUBTRACT] = {490, jit_code_INPLACE_SUBTRACT, 11, jit_holes_INPLACE_SUBTRACT},
+    [BINARY_SUBSCR] = {552, jit_code_BINARY_SUBSCR, 12, jit_holes_BINARY_SUBSCR},
+    [BINARY_MULTIPLY] = {319, jit_code_BINARY_MULTIPLY, 7, jit_holes_BINARY_MULTIPLY},
+    [BINARY_MATRIX_MULTIPLY] = {319, jit_code_BINARY_MATRIX_MULTIPLY, 7, jit_holes_BINARY_MATRIX_MULTIPLY},
+    [BINARY_TRUE_DIVIDE] = {319, jit_code_BINARY_TRUE_DIVIDE, 7, jit_holes_BINARY_TRUE_DIVIDE},
+    [BINARY_FLOOR_DIVIDE] = {319, jit_code_BINARY_FLOOR_DIVIDE, 7, jit_holes_BINARY_FLOOR_DIVIDE},
+    [BINARY_MODULO] = {319, jit_code_BINARY_MODULO, 7, jit_holes_BINARY_MODULO},
+    [BINARY_LSHIFT] = {319, jit_code_BINARY_LSHIFT, 7, jit_holes_BINARY_LSHIFT},
+    [BINARY_RSHIFT] = {319, jit_code_BINARY_RSHIFT, 7, jit_holes_BINARY_RSHIFT},
+    [BINARY_AND] = {319, jit_code_BINARY_AND, 7, jit_holes_BINARY_AND},
+    [BINARY_XOR] = {319, jit_code_BINARY_XOR, 7, jit_holes_BINARY_XOR},
+    [BINARY_OR] = {319, jit_code_BINARY_OR, 7, jit_holes_BINARY_OR},
+    [INPLACE_MULTIPLY] = {319, jit_code_INPLACE_MULTIPLY, 7, jit_holes_INPLACE_MULTIPLY},
+    [INPLACE_MATRIX_MULTIPLY] = {319, jit_code_INPLACE_MATRIX_MULTIPLY, 7, jit_holes_INPLACE_MATRIX_MULTIPLY},
+    [INPLACE_TRUE_DIVIDE] = {319, jit_code_INPLACE_TRUE_DIVIDE, 7, jit_holes_INPLACE_TRUE_DIVIDE},
+    [INPLACE_FLOOR_DIVIDE] = {319, jit_code_INPLACE_FLOOR_DIVIDE, 7, jit_holes_INPLACE_FLOOR_DIVIDE},
+    [INPLACE_MODULO] = {319, jit_code_INPLACE_MODULO, 7, jit_holes_INPLACE_MODULO},
+    [INPLACE_LSHIFT] = {319, jit_code_INPLACE_LSHIFT, 7, jit_holes_INPLACE_LSHIFT},
+    [INPLACE_RSHIFT] = {319, jit_code_INPLACE_RSHIFT, 7, jit_holes_INPLACE_RSHIFT},
+    [INPLACE_AND] = {319, jit_code_INPLACE_AND, 7, jit_holes_INPLACE_AND},
+    [INPLACE_XOR] = {319, jit_code_INPLACE_XOR, 7, jit_holes_INPLACE_XOR},
+    [INPLACE_OR] = {319, jit_code_INPLACE_OR, 7, jit_holes_INPLACE_OR},
+    [STORE_SUBSCR] = {407, jit_code_STORE_SUBSCR, 8, jit_holes_STORE_SUBSCR},
+    [DELETE_SUBSCR] = {291, jit_code_DELETE_SUBSCR, 7, jit_holes_DELETE_SUBSCR},
+    [COMPARE_OP] = {675, jit_code_COMPARE_OP, 15, jit_holes_COMPARE_OP},
+    [IS_OP] = {248, jit_code_IS_OP, 9, jit_holes_IS_OP},
+    [CONTAINS_OP] = {362, jit_code_CONTAINS_OP, 10, jit_holes_CONTAINS_OP},
+    [LOAD_ATTR] = {250, jit_code_LOAD_ATTR, 7, jit_holes_LOAD_ATTR},
+    [STORE_ATTR] = {315, jit_code_STORE_ATTR, 8, jit_holes_STORE_ATTR},
+    [LOAD_METHOD] = {352, jit_code_LOAD_METHOD, 9, jit_holes_LOAD_METHOD},
+    [CALL_METHOD] = {338, jit_code_CALL_METHOD, 8, jit_holes_CALL_METHOD},
+    [CALL_FUNCTION] = {242, jit_code_CALL_FUNCTION, 6, jit_holes_CALL_FUNCTION},
+    [CALL_FUNCTION_KW] = {258, jit_code_CALL_FUNCTION_KW, 6, jit_holes_CALL_FUNCTION_KW},
+    [BUILD_TUPLE] = {194, jit_code_BUILD_TUPLE, 5, jit_holes_BUILD_TUPLE},
+    [BUILD_LIST] = {194, jit_code_BUILD_LIST, 5, jit_holes_BUILD_LIST},
+    [BUILD_SLICE] = {436, jit_code_BUILD_SLICE, 9, jit_holes_BUILD_SLICE},
+    [LIST_APPEND] = {206, jit_code_LIST_APPEND, 6, jit_holes_LIST_APPEND},
+    [UNPACK_SEQUENCE] = {198, jit_code_UNPACK_SEQUENCE, 6, jit_holes_UNPACK_SEQUENCE},
+    [GET_ITER] = {242, jit_code_GET_ITER, 6, jit_holes_GET_ITER},
+    [FOR_ITER] = {334, jit_code_FOR_ITER, 9, jit_holes_FOR_ITER},
+    [JUMP_FORWARD] = {12, jit_code_JUMP_FORWARD, 1, jit_holes_JUMP_FORWARD},
+    [JUMP_ABSOLUTE] = {52, jit_code_JUMP_ABSOLUTE, 2, jit_holes_JUMP_ABSOLUTE},
+    [POP_JUMP_IF_FALSE] = {354, jit_code_POP_JUMP_IF_FALSE, 12, jit_holes_POP_JUMP_IF_FALSE},
+    [POP_JUMP_IF_TRUE] = {370, jit_code_POP_JUMP_IF_TRUE, 12, jit_holes_POP_JUMP_IF_TRUE},
+    [JUMP_IF_FALSE_OR_POP] = {252, jit_code_JUMP_IF_FALSE_OR_POP, 9, jit_holes_JUMP_IF_FALSE_OR_POP},
+    [JUMP_IF_TRUE_OR_POP] = {257, jit_code_JUMP_IF_TRUE_OR_POP, 9, jit_holes_JUMP_IF_TRUE_OR_POP},
+    [RETURN_VALUE] = {19, jit_code_RETURN_VALUE, 1, jit_holes_RETURN_VALUE},
+};
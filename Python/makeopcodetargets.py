@@ -34,6 +34,11 @@ def write_contents(f):
     targets = ['_unknown_opcode'] * 256
     for opname, op in opcode.opmap.items():
         targets[op] = "TARGET_%s" % opname
+    # Same assignment as in Tools/scripts/generate_opcode_h.py
+    free = [op for op in range(opcode.HAVE_ARGUMENT, 256)
+            if targets[op] == '_unknown_opcode']
+    for opname, op in zip(opcode._superinstructions, free):
+        targets[op] = "TARGET_%s" % opname
     f.write("static void *opcode_targets[256] = {\n")
     f.write(",\n".join(["    &&%s" % s for s in targets]))
     f.write("\n};\n")
@@ -662,6 +662,9 @@ new_threadstate(PyInterpreterState *interp, int init)
     tstate->context = NULL;
     tstate->context_ver = 1;
 
+    tstate->framestack_chunk = NULL;
+    tstate->framestack_top = NULL;
+
     if (init) {
         _PyThreadState_Init(tstate);
     }
@@ -872,6 +875,9 @@ PyThreadState_Clear(PyThreadState *tstate)
 
     Py_CLEAR(tstate->context);
 
+    /* Frames still alive keep their memory until they are deallocated */
+    _PyFrame_ClearStack(tstate);
+
     if (tstate->on_delete != NULL) {
         tstate->on_delete(tstate->on_delete_data);
     }
@@ -106,6 +106,7 @@ ste_new(struct symtable *st, identifier name, _Py_block_ty block,
     ste->ste_returns_value = 0;
     ste->ste_needs_class_closure = 0;
     ste->ste_comp_iter_target = 0;
+    ste->ste_comp_inlined = 0;
     ste->ste_comp_iter_expr = 0;
 
     ste->ste_symbols = PyDict_New();
@@ -614,6 +615,132 @@ analyze_cells(PyObject *scopes, PyObject *free)
     return success;
 }
 
+/* List, set and dict comprehensions directly in a function are compiled
+   inline, in the frame of the function, when they have no nested scopes.
+   Their names are then names of the function: the iteration variables are
+   saved and cleared before the comprehension runs and restored after it,
+   and the free variables refer to the function's own variables rather than
+   to cells.
+
+   A comprehension is only inlined if every name keeps its meaning in the
+   function: an iteration variable must not be a global, free or cell
+   variable of the function, and the other names must have the same scope in
+   both.  'later_free' holds the free variables of the comprehensions that
+   are not decided yet; they may still turn local names into cells.
+*/
+
+static int
+is_inline_candidate(PySTEntryObject *ste, PySTEntryObject *comp)
+{
+    return (ste->ste_type == FunctionBlock &&
+            comp->ste_comprehension != NoComprehension &&
+            comp->ste_comprehension != GeneratorExpression &&
+            !comp->ste_coroutine &&
+            PyList_GET_SIZE(comp->ste_children) == 0);
+}
+
+static int
+can_inline_comprehension(PySTEntryObject *comp, PyObject *scopes,
+                         PyObject *allfree, PyObject *later_free)
+{
+    PyObject *name, *v;
+    Py_ssize_t pos = 0;
+
+    while (PyDict_Next(comp->ste_symbols, &pos, &name, &v)) {
+        long flags = PyLong_AS_LONG(v);
+        long scope = (flags >> SCOPE_OFFSET) & SCOPE_MASK;
+        if (flags & DEF_PARAM) {
+            /* The implicit argument holding the outermost iterator */
+            continue;
+        }
+        PyObject *outer = PyDict_GetItemWithError(scopes, name);
+        if (outer == NULL && PyErr_Occurred()) {
+            return -1;
+        }
+        long outer_scope = outer ? PyLong_AS_LONG(outer) : 0;
+        if (scope == LOCAL) {
+            if (outer_scope != 0 && outer_scope != LOCAL) {
+                return 0;
+            }
+            int r = PySet_Contains(allfree, name);
+            if (r == 0) {
+                r = PySet_Contains(later_free, name);
+            }
+            if (r != 0) {
+                return r < 0 ? -1 : 0;
+            }
+        }
+        else if (outer_scope == 0 || outer_scope == scope) {
+            continue;
+        }
+        else if (scope == FREE && outer_scope == LOCAL) {
+            continue;
+        }
+        else if ((scope == GLOBAL_IMPLICIT || scope == GLOBAL_EXPLICIT) &&
+                 (outer_scope == GLOBAL_IMPLICIT ||
+                  outer_scope == GLOBAL_EXPLICIT)) {
+            continue;
+        }
+        else {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Move the names of an inlined comprehension into the enclosing function.
+   Its free variables which are locals of the function are removed from
+   comp_free, so they do not become cells. */
+static int
+inline_comprehension(PySTEntryObject *ste, PySTEntryObject *comp,
+                     PyObject *scopes, PyObject *comp_free)
+{
+    PyObject *name, *v;
+    Py_ssize_t pos = 0;
+
+    while (PyDict_Next(comp->ste_symbols, &pos, &name, &v)) {
+        long flags = PyLong_AS_LONG(v);
+        long scope = (flags >> SCOPE_OFFSET) & SCOPE_MASK;
+        if (flags & DEF_PARAM) {
+            continue;
+        }
+        PyObject *outer = PyDict_GetItemWithError(scopes, name);
+        if (outer == NULL) {
+            if (PyErr_Occurred()) {
+                return 0;
+            }
+            PyObject *o = PyLong_FromLong(flags & ((1 << SCOPE_OFFSET) - 1));
+            if (o == NULL) {
+                return 0;
+            }
+            int r = PyDict_SetItem(ste->ste_symbols, name, o);
+            Py_DECREF(o);
+            if (r < 0) {
+                return 0;
+            }
+            o = PyLong_FromLong(scope);
+            if (o == NULL) {
+                return 0;
+            }
+            r = PyDict_SetItem(scopes, name, o);
+            Py_DECREF(o);
+            if (r < 0) {
+                return 0;
+            }
+            if (scope == FREE) {
+                ste->ste_free = 1;
+            }
+        }
+        else if (scope == FREE && PyLong_AS_LONG(outer) == LOCAL) {
+            if (PySet_Discard(comp_free, name) < 0) {
+                return 0;
+            }
+        }
+    }
+    comp->ste_comp_inlined = 1;
+    return 1;
+}
+
 static int
 drop_class_free(PySTEntryObject *ste, PyObject *free)
 {
@@ -750,6 +877,7 @@ analyze_block(PySTEntryObject *ste, PyObject *bound, PyObject *free,
 {
     PyObject *name, *v, *local = NULL, *scopes = NULL, *newbound = NULL;
     PyObject *newglobal = NULL, *newfree = NULL, *allfree = NULL;
+    PyObject *inline_free = NULL, *later_free = NULL;
     PyObject *temp;
     int i, success = 0;
     Py_ssize_t pos = 0;
@@ -848,19 +976,69 @@ analyze_block(PySTEntryObject *ste, PyObject *bound, PyObject *free,
     allfree = PySet_New(NULL);
     if (!allfree)
         goto error;
+    inline_free = PyList_New(0);
+    if (!inline_free)
+        goto error;
     for (i = 0; i < PyList_GET_SIZE(ste->ste_children); ++i) {
         PyObject *c = PyList_GET_ITEM(ste->ste_children, i);
         PySTEntryObject* entry;
         assert(c && PySTEntry_Check(c));
         entry = (PySTEntryObject*)c;
-        if (!analyze_child_block(entry, newbound, newfree, newglobal,
-                                 allfree))
+        if (is_inline_candidate(ste, entry)) {
+            /* Merged into allfree below */
+            PyObject *child_free = PySet_New(NULL);
+            if (!child_free)
+                goto error;
+            if (PyList_Append(inline_free, child_free) < 0 ||
+                !analyze_child_block(entry, newbound, newfree, newglobal,
+                                     child_free)) {
+                Py_DECREF(child_free);
+                goto error;
+            }
+            Py_DECREF(child_free);
+        }
+        else if (!analyze_child_block(entry, newbound, newfree, newglobal,
+                                      allfree))
             goto error;
         /* Check if any children have free variables */
         if (entry->ste_free || entry->ste_child_free)
             ste->ste_child_free = 1;
     }
 
+    /* Decide which comprehensions are inlined, in order */
+    if (PyList_GET_SIZE(inline_free) > 0) {
+        Py_ssize_t j = 0;
+        later_free = PySet_New(NULL);
+        if (!later_free)
+            goto error;
+        for (i = 0; i < PyList_GET_SIZE(ste->ste_children); ++i) {
+            PySTEntryObject *entry =
+                (PySTEntryObject *)PyList_GET_ITEM(ste->ste_children, i);
+            if (!is_inline_candidate(ste, entry))
+                continue;
+            PyObject *child_free = PyList_GET_ITEM(inline_free, j++);
+            if (PySet_Clear(later_free) < 0)
+                goto error;
+            for (Py_ssize_t n = j; n < PyList_GET_SIZE(inline_free); n++) {
+                temp = PyNumber_InPlaceOr(later_free,
+                                          PyList_GET_ITEM(inline_free, n));
+                if (!temp)
+                    goto error;
+                Py_DECREF(temp);
+            }
+            int r = can_inline_comprehension(entry, scopes, allfree,
+                                             later_free);
+            if (r < 0)
+                goto error;
+            if (r && !inline_comprehension(ste, entry, scopes, child_free))
+                goto error;
+            temp = PyNumber_InPlaceOr(allfree, child_free);
+            if (!temp)
+                goto error;
+            Py_DECREF(temp);
+        }
+    }
+
     temp = PyNumber_InPlaceOr(newfree, allfree);
     if (!temp)
         goto error;
@@ -888,6 +1066,8 @@ analyze_block(PySTEntryObject *ste, PyObject *bound, PyObject *free,
     Py_XDECREF(newglobal);
     Py_XDECREF(newfree);
     Py_XDECREF(allfree);
+    Py_XDECREF(inline_free);
+    Py_XDECREF(later_free);
     if (!success)
         assert(PyErr_Occurred());
     return success;
@@ -0,0 +1,267 @@
+"""Generate Python/jit_stencils.h from Tools/jit/template.c.
+
+Usage: build.py CC CFLAGS OUTPUT
+
+The template is compiled once per opcode it handles.  The machine code of
+the resulting relocatable object becomes the stencil of the opcode and its
+relocations become holes, patched by Python/jit.c when it copies the
+stencil.  Stencils can only be generated for x86-64 ELF targets, with
+CFLAGS matching the interpreter build (make regen-jit passes them).
+"""
+
+import os
+import re
+import shlex
+import struct
+import subprocess
+import sys
+import tempfile
+
+TEMPLATE = os.path.join(os.path.dirname(__file__), "template.c")
+
+# Position independent code would go through the GOT; the large code model
+# turns every reference to a symbol into a 64-bit absolute relocation,
+# which can be patched wherever the stencil is copied.
+JIT_CFLAGS = [
+    "-O2",
+    "-g0",
+    "-fno-pic",
+    "-fno-pie",
+    "-mcmodel=large",
+    "-fno-asynchronous-unwind-tables",
+    "-fno-stack-protector",
+    "-fcf-protection=none",
+    "-fno-jump-tables",
+    "-fno-reorder-blocks-and-partition",
+    "-fomit-frame-pointer",
+    # The stencils are entered through _PyJIT_Enter(), which saves these
+    # registers once, instead of every stencil calling a helper
+    "-fcall-used-rbx",
+    "-fcall-used-r12",
+    "-fcall-used-r13",
+    "-fcall-used-r14",
+    "-fcall-used-r15",
+]
+
+EM_X86_64 = 62
+ET_REL = 1
+SHT_SYMTAB = 2
+SHT_RELA = 4
+SHF_ALLOC = 2
+STT_SECTION = 3
+R_X86_64_64 = 1
+
+# Symbols of the template patched with per-instruction values, see the
+# _PyJITHoleKind enum of Python/jit.c
+HOLES = {
+    "_JIT_CONTINUE": "HOLE_CONTINUE",
+    "_JIT_TARGET": "HOLE_TARGET",
+    "_JIT_OPARG": "HOLE_OPARG",
+    "_JIT_OPERAND": "HOLE_OPERAND",
+    "_JIT_INDEX": "HOLE_INDEX",
+    "_JIT_NEXT_INDEX": "HOLE_NEXT_INDEX",
+}
+
+header = """
+/* Auto-generated by Tools/jit/build.py from Tools/jit/template.c */
+""".lstrip()
+
+
+class Section:
+    def __init__(self, elf, data):
+        (self.name_offset, self.type, self.flags, _, self.offset, self.size,
+         self.link, self.info, _, self.entsize) = struct.unpack_from(
+            "<IIQQQQIIQQ", elf, data)
+
+    def contents(self, elf):
+        return elf[self.offset:self.offset + self.size]
+
+
+class Object:
+    """The sections, symbols and relocations of an ELF relocatable file"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            elf = f.read()
+        if elf[:4] != b"\x7fELF" or elf[4] != 2 or elf[5] != 1:
+            raise ValueError(f"{path}: not a 64-bit little-endian ELF file")
+        (e_type, e_machine) = struct.unpack_from("<HH", elf, 16)
+        if e_type != ET_REL or e_machine != EM_X86_64:
+            raise ValueError(f"{path}: not an x86-64 relocatable object")
+        (e_shoff,) = struct.unpack_from("<Q", elf, 40)
+        (e_shentsize, e_shnum, e_shstrndx) = struct.unpack_from(
+            "<HHH", elf, 58)
+        self.sections = [Section(elf, e_shoff + i * e_shentsize)
+                         for i in range(e_shnum)]
+        names = self.sections[e_shstrndx].contents(elf)
+        for section in self.sections:
+            section.name = cstring(names, section.name_offset)
+        self.elf = elf
+
+        self.symbols = []
+        self.relocations = {}
+        for section in self.sections:
+            if section.type == SHT_SYMTAB:
+                strings = self.sections[section.link].contents(elf)
+                data = section.contents(elf)
+                for offset in range(0, len(data), 24):
+                    (name, info, _, shndx, value, size) = struct.unpack_from(
+                        "<IBBHQQ", data, offset)
+                    self.symbols.append((cstring(strings, name), info & 0xf,
+                                         shndx, value, size))
+        for section in self.sections:
+            if section.type == SHT_RELA:
+                data = section.contents(elf)
+                relocations = self.relocations.setdefault(section.info, [])
+                for offset in range(0, len(data), 24):
+                    (r_offset, r_info, r_addend) = struct.unpack_from(
+                        "<QQq", data, offset)
+                    relocations.append(
+                        (r_offset, r_info & 0xffffffff, r_info >> 32,
+                         r_addend))
+
+    def symbol(self, name):
+        for symbol in self.symbols:
+            if symbol[0] == name:
+                return symbol
+        raise ValueError(f"no symbol {name}")
+
+    def section_index(self, name):
+        for i, section in enumerate(self.sections):
+            if section.name == name:
+                return i
+        raise ValueError(f"no section {name}")
+
+
+def cstring(data, offset):
+    return data[offset:data.index(b"\0", offset)].decode()
+
+
+def compile(cc, cflags, defines, tmpdir):
+    out = os.path.join(tmpdir, "template.o")
+    args = [*cc, *cflags, *JIT_CFLAGS,
+            *(f"-D{name}={value}" for name, value in defines.items()),
+            "-c", TEMPLATE, "-o", out]
+    subprocess.run(args, check=True)
+    return Object(out)
+
+
+def stencil(obj, opname):
+    """Return the code and holes of the _JIT_ENTRY function of obj"""
+    text_index = obj.section_index(".text")
+    for i, section in enumerate(obj.sections):
+        if section.flags & SHF_ALLOC and section.size and i != text_index:
+            raise ValueError(f"{opname}: unexpected section {section.name}")
+    text = obj.sections[text_index]
+    code = bytearray(text.contents(obj.elf))
+    (_, _, shndx, entry, size) = obj.symbol("_JIT_ENTRY")
+    if shndx != text_index or entry != 0:
+        raise ValueError(f"{opname}: _JIT_ENTRY is not at the start of .text")
+
+    holes = []
+    for (offset, kind, index, addend) in obj.relocations.get(text_index, []):
+        if kind != R_X86_64_64:
+            raise ValueError(f"{opname}: unsupported relocation type {kind}")
+        (name, type, shndx, _, _) = obj.symbols[index]
+        if type == STT_SECTION and shndx == text_index:
+            holes.append((offset, "HOLE_BASE", None, addend))
+        elif name in HOLES:
+            holes.append((offset, HOLES[name], None, addend))
+        elif shndx == 0:
+            holes.append((offset, "HOLE_SYMBOL", name, addend))
+        else:
+            raise ValueError(f"{opname}: unexpected relocation to {name}")
+    holes.sort()
+
+    # The code of the next instruction is copied right after this one, so
+    # a final "movabs $_JIT_CONTINUE, %reg; jmp *%reg" can be dropped.
+    if holes and holes[-1][1:] == ("HOLE_CONTINUE", None, 0):
+        offset = holes[-1][0]
+        rex, mov = code[offset - 2:offset]
+        tail = bytes(code[offset + 8:])
+        reg = mov - 0xb8
+        if (entry + size == len(code) and 0 <= reg < 8 and
+            (rex == 0x48 and tail == bytes([0xff, 0xe0 + reg]) or
+             rex == 0x49 and tail == bytes([0x41, 0xff, 0xe0 + reg]))):
+            del code[offset - 2:]
+            del holes[-1]
+    return code, holes
+
+
+def layout(obj):
+    (_, _, shndx, value, size) = obj.symbol("_JIT_LAYOUT")
+    data = obj.sections[shndx].contents(obj.elf)[value:value + size]
+    return struct.unpack(f"<{size // 8}q", data)
+
+
+def opnames():
+    with open(TEMPLATE) as f:
+        names = re.findall(r"^    case ([A-Z_]+):", f.read(), re.MULTILINE)
+    return ["0"] + names
+
+
+def write_bytes(out, code):
+    for i in range(0, len(code), 12):
+        line = ", ".join(f"0x{byte:02x}" for byte in code[i:i + 12])
+        out.write(f"    {line},\n")
+
+
+def main(cc, cflags, outfile):
+    cc = shlex.split(cc)
+    cflags = shlex.split(cflags)
+    stencils = {}
+    symbols = set()
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for opname in opnames():
+            obj = compile(cc, cflags, {"_JIT_OPCODE": opname}, tmpdir)
+            stencils[opname] = stencil(obj, opname)
+            symbols.update(name for _, _, name, _ in stencils[opname][1]
+                           if name is not None)
+        obj = compile(cc, cflags, {"_JIT_OPCODE": "0",
+                                   "_JIT_LAYOUT_PROBE": "1"}, tmpdir)
+        values = layout(obj)
+    symbols = sorted(symbols)
+
+    with open(outfile, "w") as out:
+        out.write(header)
+        out.write("\n/* Values of _PyJIT_LAYOUT the stencils were compiled "
+                  "with */\n")
+        out.write("static const Py_ssize_t jit_layout[] = {\n")
+        out.write("    " + ", ".join(map(str, values)) + ",\n")
+        out.write("};\n\n")
+        out.write("/* C symbols referenced by the stencils */\n")
+        out.write("#define JIT_SYMBOLS(SYMBOL) \\\n")
+        for name in symbols:
+            out.write(f"    SYMBOL({name}) \\\n")
+        out.write("\n")
+        for opname, (code, holes) in stencils.items():
+            name = "unsupported" if opname == "0" else opname
+            if code:
+                out.write(f"static const unsigned char jit_code_{name}[] = {{\n")
+                write_bytes(out, code)
+                out.write("};\n")
+            if holes:
+                out.write(f"static const JITHole jit_holes_{name}[] = {{\n")
+                for offset, kind, symbol, addend in holes:
+                    index = symbols.index(symbol) if symbol else 0
+                    out.write(f"    {{0x{offset:x}, {kind}, {index}, "
+                              f"{addend}}},\n")
+                out.write("};\n")
+            out.write("\n")
+        out.write("static const JITStencil jit_stencils[256] = {\n")
+        for opname, (code, holes) in stencils.items():
+            name = "unsupported" if opname == "0" else opname
+            # The code pointer tells supported opcodes apart, keep it set
+            code_ref = f"jit_code_{name}" if code else '(const unsigned char *)""'
+            holes_ref = f"jit_holes_{name}" if holes else "NULL"
+            out.write(f"    [{opname}] = {{{len(code)}, {code_ref}, "
+                      f"{len(holes)}, {holes_ref}}},\n")
+        out.write("};\n")
+
+    print(f"{outfile} regenerated from {TEMPLATE}")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    main(*sys.argv[1:])
@@ -0,0 +1,769 @@
+/* Machine code templates of the copy-and-patch JIT.
+
+   Tools/jit/build.py compiles this file once for every opcode handled
+   below, with _JIT_OPCODE defined to it, and turns the machine code of
+   _JIT_ENTRY() into a stencil of Python/jit_stencils.h.  Python/jit.c
+   copies one stencil per instruction and patches the references to the
+   _JIT_* symbols:
+
+   _JIT_CONTINUE   the next instruction
+   _JIT_TARGET     the jump target of the instruction
+   _JIT_OPARG      the argument of the instruction (with EXTENDED_ARG)
+   _JIT_OPERAND    an object or cache chosen by Python/jit.c
+   _JIT_INDEX      the index of the instruction (of its first EXTENDED_ARG)
+   _JIT_NEXT_INDEX the index of the next instruction
+
+   Keep the stencils small: anything longer than a few lines belongs in a
+   helper of Python/jit.c.  Struct members used directly here must be
+   listed in _PyJIT_LAYOUT. */
+
+#include "Python.h"
+#include "pycore_jit.h"
+#include "pycore_long.h"          // _PyLong_Add()
+#include "frameobject.h"
+#include "opcode.h"
+
+extern _PyJITResult _JIT_CONTINUE(PyFrameObject *, PyObject **,
+                                  PyThreadState *);
+extern _PyJITResult _JIT_TARGET(PyFrameObject *, PyObject **,
+                                PyThreadState *);
+extern char _JIT_OPARG[];
+extern char _JIT_OPERAND[];
+extern char _JIT_INDEX[];
+extern char _JIT_NEXT_INDEX[];
+
+#define OPARG ((int)(uintptr_t)_JIT_OPARG)
+#define OPERAND ((PyObject *)_JIT_OPERAND)
+#define INDEX ((int)(uintptr_t)_JIT_INDEX)
+#define NEXT_INDEX ((int)(uintptr_t)_JIT_NEXT_INDEX)
+
+#define GETLOCAL(i)     (f->f_localsplus[(i)])
+#define TOP()           (stack_pointer[-1])
+#define SECOND()        (stack_pointer[-2])
+#define THIRD()         (stack_pointer[-3])
+#define FOURTH()        (stack_pointer[-4])
+#define PEEK(n)         (stack_pointer[-(n)])
+#define SET_TOP(v)      (stack_pointer[-1] = (v))
+#define SET_SECOND(v)   (stack_pointer[-2] = (v))
+#define SET_THIRD(v)    (stack_pointer[-3] = (v))
+#define SET_FOURTH(v)   (stack_pointer[-4] = (v))
+#define PUSH(v)         (*stack_pointer++ = (v))
+#define POP()           (*--stack_pointer)
+#define STACK_SHRINK(n) (stack_pointer -= (n))
+
+#define CONTINUE() return _JIT_CONTINUE(f, stack_pointer, tstate)
+#define JUMP() return _JIT_TARGET(f, stack_pointer, tstate)
+
+/* Py_DECREF(op) and go on with the code at next.  Deallocating op is a
+   tail call, so that the stencil needs no stack frame of its own.  (The
+   JIT is disabled in Py_REF_DEBUG builds, which would have to update
+   _Py_RefTotal as well.) */
+#define DECREF_AND_GOTO(op, next) \
+    do { \
+        if (Py_REFCNT(op) == 1) { \
+            return _PyJIT_DecrefAndGoto((op), f, stack_pointer, tstate, \
+                                        (next)); \
+        } \
+        Py_SET_REFCNT((op), Py_REFCNT(op) - 1); \
+        return (next)(f, stack_pointer, tstate); \
+    } while (0)
+
+/* Leave the machine code, see enum _PyJIT_Status */
+#define EXIT(lasti, status) \
+    do { \
+        f->f_lasti = (lasti); \
+        return (_PyJITResult){stack_pointer, (status)}; \
+    } while (0)
+#define ERROR() EXIT(INDEX, _PyJIT_ERROR)
+/* Let the interpreter run this instruction; only before side effects */
+#define DEOPT() EXIT(INDEX, _PyJIT_DEOPT)
+
+/* After anything that can run arbitrary code: a trace function set by
+   it must see the following instructions. */
+#define CHECK_TRACING() \
+    do { \
+        if (tstate->cframe->use_tracing) { \
+            EXIT(INDEX, _PyJIT_TRACE); \
+        } \
+    } while (0)
+
+/* Signals, pending calls and GIL drop requests are handled by the
+   interpreter, at the same instructions as in _PyEval_EvalFrameDefault() */
+#define EVAL_BREAKER() \
+    _Py_atomic_load_relaxed(&tstate->interp->ceval.eval_breaker)
+
+/* Instructions which cannot raise nor run arbitrary code do not need to
+   update f_lasti; the others keep it right for tracebacks, warnings and
+   sys._getframe().f_lineno. */
+#define SETS_LASTI(op) \
+    ((op) != NOP && (op) != SETUP_FINALLY && (op) != POP_BLOCK && \
+     (op) != LOAD_FAST && (op) != LOAD_FAST_AND_CLEAR && \
+     (op) != LOAD_CONST && (op) != LOAD_CLOSURE && \
+     (op) != ROT_TWO && (op) != ROT_THREE && (op) != ROT_FOUR && \
+     (op) != DUP_TOP && (op) != DUP_TOP_TWO && \
+     (op) != JUMP_FORWARD && (op) != JUMP_ABSOLUTE && (op) != 0)
+
+/* End an instruction that computed res from n operands */
+#define BINARY_RESULT(n) \
+    do { \
+        STACK_SHRINK(n); \
+        if (res == NULL) { \
+            ERROR(); \
+        } \
+        PUSH(res); \
+        CHECK_TRACING(); \
+        CONTINUE(); \
+    } while (0)
+
+/* End a call instruction; the interpreter takes over when eval_breaker
+   was set during the call */
+#define CALL_RESULT(n) \
+    do { \
+        STACK_SHRINK(n); \
+        if (res == NULL) { \
+            ERROR(); \
+        } \
+        PUSH(res); \
+        CHECK_TRACING(); \
+        if (EVAL_BREAKER()) { \
+            EXIT(NEXT_INDEX, _PyJIT_DEOPT); \
+        } \
+        CONTINUE(); \
+    } while (0)
+
+#define BINARY_OP(func) \
+    { \
+        PyObject *right = TOP(); \
+        PyObject *left = SECOND(); \
+        PyObject *res = func(left, right); \
+        Py_DECREF(left); \
+        Py_DECREF(right); \
+        BINARY_RESULT(2); \
+    }
+
+/* The value of an int of at most one digit, see MEDIUM_VALUE() in
+   longobject.c */
+#define IS_SMALL_INT(o) \
+    (PyLong_CheckExact(o) && (size_t)(Py_SIZE(o) + 1) < 3)
+#define SMALL_INT_VALUE(o) \
+    (Py_SIZE(o) * (Py_ssize_t)((PyLongObject *)(o))->ob_digit[0])
+
+#define UNARY_OP(func) \
+    { \
+        PyObject *value = TOP(); \
+        PyObject *res = func(value); \
+        Py_DECREF(value); \
+        BINARY_RESULT(1); \
+    }
+
+_PyJITResult
+_JIT_ENTRY(PyFrameObject *f, PyObject **stack_pointer, PyThreadState *tstate)
+{
+    if (SETS_LASTI(_JIT_OPCODE)) {
+        f->f_lasti = INDEX;
+    }
+
+    switch (_JIT_OPCODE) {
+
+    /* Not an opcode: instructions without a stencil of their own */
+    case 0:
+        DEOPT();
+
+    /* The try blocks are in the exception table, see _PyCode_HasExcTable() */
+    case SETUP_FINALLY:
+    case POP_BLOCK:
+    case NOP:
+        CONTINUE();
+
+    case LOAD_FAST: {
+        PyObject *value = GETLOCAL(OPARG);
+        if (value == NULL) {
+            DEOPT();
+        }
+        Py_INCREF(value);
+        PUSH(value);
+        CONTINUE();
+    }
+
+    case LOAD_FAST_AND_CLEAR: {
+        PUSH(GETLOCAL(OPARG));
+        GETLOCAL(OPARG) = NULL;
+        CONTINUE();
+    }
+
+    case LOAD_CONST: {
+        PyObject *value = OPERAND;
+        Py_INCREF(value);
+        PUSH(value);
+        CONTINUE();
+    }
+
+    case STORE_FAST: {
+        PyObject *old = GETLOCAL(OPARG);
+        GETLOCAL(OPARG) = POP();
+        if (old == NULL) {
+            CONTINUE();
+        }
+        DECREF_AND_GOTO(old, _JIT_CONTINUE);
+    }
+
+    case LOAD_CLOSURE: {
+        PyObject *cell = GETLOCAL(OPARG);
+        Py_INCREF(cell);
+        PUSH(cell);
+        CONTINUE();
+    }
+
+    case LOAD_DEREF: {
+        PyObject *value = PyCell_Get(GETLOCAL(OPARG));
+        if (value == NULL) {
+            DEOPT();
+        }
+        PUSH(value);
+        CONTINUE();
+    }
+
+    case STORE_DEREF: {
+        PyObject *value = POP();
+        PyCell_Set(GETLOCAL(OPARG), value);
+        Py_DECREF(value);
+        CHECK_TRACING();
+        CONTINUE();
+    }
+
+    case LOAD_GLOBAL: {
+        _PyJITLoadGlobal *cache = (_PyJITLoadGlobal *)_JIT_OPERAND;
+        PyObject *globals = f->f_globals;
+        PyObject *builtins = f->f_builtins;
+        PyObject *value;
+        if (cache->ptr != NULL &&
+            ((PyDictObject *)globals)->ma_version_tag == cache->globals_ver &&
+            ((PyDictObject *)builtins)->ma_version_tag == cache->builtins_ver)
+        {
+            value = cache->ptr;
+            Py_INCREF(value);
+        }
+        else {
+            value = _PyJIT_LoadGlobal(f, cache);
+            if (value == NULL) {
+                if (PyErr_Occurred()) {
+                    ERROR();
+                }
+                DEOPT();
+            }
+        }
+        PUSH(value);
+        CONTINUE();
+    }
+
+    case POP_TOP: {
+        PyObject *value = POP();
+        DECREF_AND_GOTO(value, _JIT_CONTINUE);
+    }
+
+    case ROT_TWO: {
+        PyObject *top = TOP();
+        PyObject *second = SECOND();
+        SET_TOP(second);
+        SET_SECOND(top);
+        CONTINUE();
+    }
+
+    case ROT_THREE: {
+        PyObject *top = TOP();
+        PyObject *second = SECOND();
+        PyObject *third = THIRD();
+        SET_TOP(second);
+        SET_SECOND(third);
+        SET_THIRD(top);
+        CONTINUE();
+    }
+
+    case ROT_FOUR: {
+        PyObject *top = TOP();
+        PyObject *second = SECOND();
+        PyObject *third = THIRD();
+        PyObject *fourth = FOURTH();
+        SET_TOP(second);
+        SET_SECOND(third);
+        SET_THIRD(fourth);
+        SET_FOURTH(top);
+        CONTINUE();
+    }
+
+    case DUP_TOP: {
+        PyObject *top = TOP();
+        Py_INCREF(top);
+        PUSH(top);
+        CONTINUE();
+    }
+
+    case DUP_TOP_TWO: {
+        PyObject *top = TOP();
+        PyObject *second = SECOND();
+        Py_INCREF(top);
+        Py_INCREF(second);
+        PUSH(second);
+        PUSH(top);
+        CONTINUE();
+    }
+
+    case UNARY_POSITIVE:
+        UNARY_OP(PyNumber_Positive)
+    case UNARY_NEGATIVE:
+        UNARY_OP(PyNumber_Negative)
+    case UNARY_INVERT:
+        UNARY_OP(PyNumber_Invert)
+
+    case UNARY_NOT: {
+        PyObject *value = TOP();
+        int err = PyObject_IsTrue(value);
+        Py_DECREF(value);
+        if (err < 0) {
+            STACK_SHRINK(1);
+            ERROR();
+        }
+        PyObject *res = err ? Py_False : Py_True;
+        Py_INCREF(res);
+        SET_TOP(res);
+        CHECK_TRACING();
+        CONTINUE();
+    }
+
+    case BINARY_POWER: {
+        PyObject *right = TOP();
+        PyObject *left = SECOND();
+        PyObject *res = PyNumber_Power(left, right, Py_None);
+        Py_DECREF(left);
+        Py_DECREF(right);
+        BINARY_RESULT(2);
+    }
+
+    case INPLACE_POWER: {
+        PyObject *right = TOP();
+        PyObject *left = SECOND();
+        PyObject *res = PyNumber_InPlacePower(left, right, Py_None);
+        Py_DECREF(left);
+        Py_DECREF(right);
+        BINARY_RESULT(2);
+    }
+
+    /* The int and float cases are those of binary_op_specialized() in
+       ceval.c */
+    case BINARY_ADD:
+    case INPLACE_ADD: {
+        PyObject *right = TOP();
+        PyObject *left = SECOND();
+        PyObject *res;
+        if (PyLong_CheckExact(left) && PyLong_CheckExact(right)) {
+            res = _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
+            Py_DECREF(left);
+        }
+        else if (PyFloat_CheckExact(left) && PyFloat_CheckExact(right)) {
+            res = PyFloat_FromDouble(PyFloat_AS_DOUBLE(left) +
+                                     PyFloat_AS_DOUBLE(right));
+            Py_DECREF(left);
+        }
+        else if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
+            /* Consumes left, see unicode_concatenate() in ceval.c */
+            res = _PyJIT_UnicodeConcatenate(f, left, right, OPARG);
+        }
+        else {
+            res = _JIT_OPCODE == BINARY_ADD ? PyNumber_Add(left, right)
+                                            : PyNumber_InPlaceAdd(left, right);
+            Py_DECREF(left);
+        }
+        Py_DECREF(right);
+        BINARY_RESULT(2);
+    }
+
+    case BINARY_SUBTRACT:
+    case INPLACE_SUBTRACT: {
+        PyObject *right = TOP();
+        PyObject *left = SECOND();
+        PyObject *res;
+        if (PyLong_CheckExact(left) && PyLong_CheckExact(right)) {
+            res = _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
+        }
+        else if (PyFloat_CheckExact(left) && PyFloat_CheckExact(right)) {
+            res = PyFloat_FromDouble(PyFloat_AS_DOUBLE(left) -
+                                     PyFloat_AS_DOUBLE(right));
+        }
+        else {
+            res = _JIT_OPCODE == BINARY_SUBTRACT
+                ? PyNumber_Subtract(left, right)
+                : PyNumber_InPlaceSubtract(left, right);
+        }
+        Py_DECREF(left);
+        Py_DECREF(right);
+        BINARY_RESULT(2);
+    }
+
+    case BINARY_SUBSCR: {
+        PyObject *sub = TOP();
+        PyObject *container = SECOND();
+        PyObject *res;
+        if (PyList_CheckExact(container) && IS_SMALL_INT(sub) &&
+            (size_t)SMALL_INT_VALUE(sub) < (size_t)PyList_GET_SIZE(container))
+        {
+            res = PyList_GET_ITEM(container, SMALL_INT_VALUE(sub));
+            Py_INCREF(res);
+        }
+        else if (PyTuple_CheckExact(container) && IS_SMALL_INT(sub) &&
+                 (size_t)SMALL_INT_VALUE(sub) < (size_t)PyTuple_GET_SIZE(container))
+        {
+            res = PyTuple_GET_ITEM(container, SMALL_INT_VALUE(sub));
+            Py_INCREF(res);
+        }
+        else {
+            res = PyObject_GetItem(container, sub);
+        }
+        Py_DECREF(container);
+        Py_DECREF(sub);
+        BINARY_RESULT(2);
+    }
+
+    case BINARY_MULTIPLY:
+        BINARY_OP(PyNumber_Multiply)
+    case BINARY_MATRIX_MULTIPLY:
+        BINARY_OP(PyNumber_MatrixMultiply)
+    case BINARY_TRUE_DIVIDE:
+        BINARY_OP(PyNumber_TrueDivide)
+    case BINARY_FLOOR_DIVIDE:
+        BINARY_OP(PyNumber_FloorDivide)
+    case BINARY_MODULO:
+        BINARY_OP(PyNumber_Remainder)
+    case BINARY_LSHIFT:
+        BINARY_OP(PyNumber_Lshift)
+    case BINARY_RSHIFT:
+        BINARY_OP(PyNumber_Rshift)
+    case BINARY_AND:
+        BINARY_OP(PyNumber_And)
+    case BINARY_XOR:
+        BINARY_OP(PyNumber_Xor)
+    case BINARY_OR:
+        BINARY_OP(PyNumber_Or)
+    case INPLACE_MULTIPLY:
+        BINARY_OP(PyNumber_InPlaceMultiply)
+    case INPLACE_MATRIX_MULTIPLY:
+        BINARY_OP(PyNumber_InPlaceMatrixMultiply)
+    case INPLACE_TRUE_DIVIDE:
+        BINARY_OP(PyNumber_InPlaceTrueDivide)
+    case INPLACE_FLOOR_DIVIDE:
+        BINARY_OP(PyNumber_InPlaceFloorDivide)
+    case INPLACE_MODULO:
+        BINARY_OP(PyNumber_InPlaceRemainder)
+    case INPLACE_LSHIFT:
+        BINARY_OP(PyNumber_InPlaceLshift)
+    case INPLACE_RSHIFT:
+        BINARY_OP(PyNumber_InPlaceRshift)
+    case INPLACE_AND:
+        BINARY_OP(PyNumber_InPlaceAnd)
+    case INPLACE_XOR:
+        BINARY_OP(PyNumber_InPlaceXor)
+    case INPLACE_OR:
+        BINARY_OP(PyNumber_InPlaceOr)
+
+    case STORE_SUBSCR: {
+        PyObject *sub = TOP();
+        PyObject *container = SECOND();
+        PyObject *value = THIRD();
+        int err = PyObject_SetItem(container, sub, value);
+        Py_DECREF(value);
+        Py_DECREF(container);
+        Py_DECREF(sub);
+        STACK_SHRINK(3);
+        if (err != 0) {
+            ERROR();
+        }
+        CHECK_TRACING();
+        CONTINUE();
+    }
+
+    case DELETE_SUBSCR: {
+        PyObject *sub = TOP();
+        PyObject *container = SECOND();
+        int err = PyObject_DelItem(container, sub);
+        Py_DECREF(container);
+        Py_DECREF(sub);
+        STACK_SHRINK(2);
+        if (err != 0) {
+            ERROR();
+        }
+        CHECK_TRACING();
+        CONTINUE();
+    }
+
+    case COMPARE_OP: {
+        PyObject *right = TOP();
+        PyObject *left = SECOND();
+        PyObject *res;
+        if (IS_SMALL_INT(left) && IS_SMALL_INT(right)) {
+            Py_ssize_t a = SMALL_INT_VALUE(left);
+            Py_ssize_t b = SMALL_INT_VALUE(right);
+            int cmp;
+            switch (OPARG) {
+            case Py_LT: cmp = a < b; break;
+            case Py_LE: cmp = a <= b; break;
+            case Py_EQ: cmp = a == b; break;
+            case Py_NE: cmp = a != b; break;
+            case Py_GT: cmp = a > b; break;
+            default: cmp = a >= b; break;
+            }
+            res = cmp ? Py_True : Py_False;
+            Py_INCREF(res);
+        }
+        else if (Py_TYPE(left) == Py_TYPE(right) &&
+                 (PyLong_CheckExact(left) || PyFloat_CheckExact(left) ||
+                  PyUnicode_CheckExact(left)))
+        {
+            /* What PyObject_RichCompare() ends up calling, see
+               compare_op_specialized() in ceval.c */
+            res = Py_TYPE(left)->tp_richcompare(left, right, OPARG);
+        }
+        else {
+            res = PyObject_RichCompare(left, right, OPARG);
+        }
+        Py_DECREF(left);
+        Py_DECREF(right);
+        BINARY_RESULT(2);
+    }
+
+    case IS_OP: {
+        PyObject *right = POP();
+        PyObject *left = TOP();
+        PyObject *res = ((left == right) ^ OPARG) ? Py_True : Py_False;
+        Py_INCREF(res);
+        SET_TOP(res);
+        Py_DECREF(left);
+        Py_DECREF(right);
+        CONTINUE();
+    }
+
+    case CONTAINS_OP: {
+        PyObject *right = TOP();
+        PyObject *left = SECOND();
+        int res = PySequence_Contains(right, left);
+        Py_DECREF(left);
+        Py_DECREF(right);
+        STACK_SHRINK(2);
+        if (res < 0) {
+            ERROR();
+        }
+        PyObject *b = (res ^ OPARG) ? Py_True : Py_False;
+        Py_INCREF(b);
+        PUSH(b);
+        CHECK_TRACING();
+        CONTINUE();
+    }
+
+    case LOAD_ATTR: {
+        PyObject *owner = TOP();
+        PyObject *res = _PyJIT_LoadAttr(owner, (_PyJITLoadAttr *)_JIT_OPERAND);
+        Py_DECREF(owner);
+        BINARY_RESULT(1);
+    }
+
+    case STORE_ATTR: {
+        PyObject *owner = TOP();
+        PyObject *value = SECOND();
+        int err = PyObject_SetAttr(owner, OPERAND, value);
+        Py_DECREF(value);
+        Py_DECREF(owner);
+        STACK_SHRINK(2);
+        if (err != 0) {
+            ERROR();
+        }
+        CHECK_TRACING();
+        CONTINUE();
+    }
+
+    case LOAD_METHOD: {
+        /* The method is stored in the free slot above the stack: taking
+           the address of a local would keep the compiler from turning the
+           jump to the next instruction into a tail call. */
+        PyObject *obj = TOP();
+        stack_pointer[0] = NULL;
+        int meth_found = _PyObject_GetMethod(obj, OPERAND, stack_pointer);
+        PyObject *meth = stack_pointer[0];
+        if (meth == NULL) {
+            STACK_SHRINK(1);
+            Py_DECREF(obj);
+            ERROR();
+        }
+        if (meth_found) {
+            /* unbound method and self */
+            SET_TOP(meth);
+            PUSH(obj);
+        }
+        else {
+            /* NULL and the attribute */
+            SET_TOP(NULL);
+            Py_DECREF(obj);
+            PUSH(meth);
+        }
+        CHECK_TRACING();
+        CONTINUE();
+    }
+
+    case CALL_METHOD: {
+        PyObject *res;
+        if (PEEK(OPARG + 2) == NULL) {
+            res = _PyJIT_CallFunction(tstate, stack_pointer, OPARG, NULL);
+        }
+        else {
+            res = _PyJIT_CallFunction(tstate, stack_pointer, OPARG + 1, NULL);
+        }
+        CALL_RESULT(OPARG + 2);
+    }
+
+    case CALL_FUNCTION: {
+        PyObject *res = _PyJIT_CallFunction(tstate, stack_pointer, OPARG,
+                                            NULL);
+        CALL_RESULT(OPARG + 1);
+    }
+
+    case CALL_FUNCTION_KW: {
+        PyObject *names = POP();
+        PyObject *res = _PyJIT_CallFunction(tstate, stack_pointer, OPARG,
+                                            names);
+        CALL_RESULT(OPARG + 1);
+    }
+
+    case BUILD_TUPLE: {
+        PyObject *res = _PyJIT_BuildTuple(stack_pointer, OPARG);
+        BINARY_RESULT(OPARG);
+    }
+
+    case BUILD_LIST: {
+        PyObject *res = _PyJIT_BuildList(stack_pointer, OPARG);
+        BINARY_RESULT(OPARG);
+    }
+
+    case BUILD_SLICE: {
+        PyObject *step = OPARG == 3 ? POP() : NULL;
+        PyObject *stop = TOP();
+        PyObject *start = SECOND();
+        PyObject *res = PySlice_New(start, stop, step);
+        Py_DECREF(start);
+        Py_DECREF(stop);
+        Py_XDECREF(step);
+        BINARY_RESULT(2);
+    }
+
+    case LIST_APPEND: {
+        PyObject *value = POP();
+        PyObject *list = PEEK(OPARG);
+        int err = PyList_Append(list, value);
+        Py_DECREF(value);
+        if (err != 0) {
+            ERROR();
+        }
+        CONTINUE();
+    }
+
+    case UNPACK_SEQUENCE: {
+        PyObject *seq = TOP();
+        if (!_PyJIT_UnpackSequence(seq, OPARG, stack_pointer - 1)) {
+            /* Not a tuple or list of the right size */
+            DEOPT();
+        }
+        STACK_SHRINK(1);
+        stack_pointer += OPARG;
+        Py_DECREF(seq);
+        CONTINUE();
+    }
+
+    case GET_ITER: {
+        PyObject *iterable = TOP();
+        PyObject *res = PyObject_GetIter(iterable);
+        Py_DECREF(iterable);
+        BINARY_RESULT(1);
+    }
+
+    case FOR_ITER: {
+        PyObject *next = _PyJIT_IterNext(TOP());
+        if (next != NULL) {
+            PUSH(next);
+            CHECK_TRACING();
+            CONTINUE();
+        }
+        if (PyErr_Occurred()) {
+            ERROR();
+        }
+        /* iterator ended normally */
+        PyObject *iter = POP();
+        Py_DECREF(iter);
+        CHECK_TRACING();
+        JUMP();
+    }
+
+    case JUMP_FORWARD:
+        JUMP();
+
+    case JUMP_ABSOLUTE: {
+        if (EVAL_BREAKER()) {
+            DEOPT();
+        }
+        JUMP();
+    }
+
+    case POP_JUMP_IF_FALSE:
+    case POP_JUMP_IF_TRUE: {
+        if (EVAL_BREAKER()) {
+            DEOPT();
+        }
+        PyObject *cond = POP();
+        int err;
+        if (cond == Py_True) {
+            err = 1;
+        }
+        else if (cond == Py_False) {
+            err = 0;
+        }
+        else {
+            err = PyObject_IsTrue(cond);
+            if (err < 0) {
+                Py_DECREF(cond);
+                ERROR();
+            }
+        }
+        if (err == (_JIT_OPCODE == POP_JUMP_IF_TRUE)) {
+            DECREF_AND_GOTO(cond, _JIT_TARGET);
+        }
+        DECREF_AND_GOTO(cond, _JIT_CONTINUE);
+    }
+
+    case JUMP_IF_FALSE_OR_POP:
+    case JUMP_IF_TRUE_OR_POP: {
+        PyObject *cond = TOP();
+        int err;
+        if (cond == Py_True) {
+            err = 1;
+        }
+        else if (cond == Py_False) {
+            err = 0;
+        }
+        else {
+            err = PyObject_IsTrue(cond);
+            if (err < 0) {
+                ERROR();
+            }
+        }
+        if (err == (_JIT_OPCODE == JUMP_IF_TRUE_OR_POP)) {
+            JUMP();
+        }
+        STACK_SHRINK(1);
+        DECREF_AND_GOTO(cond, _JIT_CONTINUE);
+    }
+
+    case RETURN_VALUE:
+        return (_PyJITResult){stack_pointer, _PyJIT_RETURN};
+
+    }
+    Py_UNREACHABLE();
+}
+
+#ifdef _JIT_LAYOUT_PROBE
+const Py_ssize_t _JIT_LAYOUT[] = {_PyJIT_LAYOUT};
+#endif
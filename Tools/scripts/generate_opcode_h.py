@@ -43,6 +43,14 @@ def write_int_array_from_ops(name, ops, out):
     assert bits == 0
     out.write(f"}};\n")
 
+def superinstruction_opcodes(opcode):
+    """Assign the unused opcodes from HAVE_ARGUMENT on to the
+    superinstructions.  Python/makeopcodetargets.py does the same."""
+    opname = opcode['opname']
+    free = [op for op in range(opcode['HAVE_ARGUMENT'], 256)
+            if opname[op] == '<%r>' % (op,)]
+    return dict(zip(opcode['_superinstructions'], free))
+
 def main(opcode_py, outfile='Include/opcode.h'):
     opcode = {}
     if hasattr(tokenize, 'open'):
@@ -63,6 +71,9 @@ def main(opcode_py, outfile='Include/opcode.h'):
             if name == 'POP_EXCEPT': # Special entry for HAVE_ARGUMENT
                 fobj.write("#define %-23s %3d\n" %
                             ('HAVE_ARGUMENT', opcode['HAVE_ARGUMENT']))
+        fobj.write("\n    /* Superinstructions, see Lib/opcode.py */\n")
+        for name, op in superinstruction_opcodes(opcode).items():
+            fobj.write("#define %-23s %3s\n" % (name, op))
         fobj.write("#ifdef NEED_OPCODE_JUMP_TABLES\n")
         write_int_array_from_ops("_PyOpcode_RelativeJump", opcode['hasjrel'], fobj)
         write_int_array_from_ops("_PyOpcode_Jump", opcode['hasjrel'] + opcode['hasjabs'], fobj)